@@ -0,0 +1,103 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class AcceptanceFilter
+ * Allowlist of frames evaluated while the frame header is decoded.
+ * A frame is accepted if it matches any rule, an empty filter accepts every frame
+ */
+class AcceptanceFilter {
+public:
+  /**
+   * Frame matches the rule if every field equals the rule value in the bits set in the mask. Zero mask matches any value
+   */
+  struct Rule {
+    Address master     = 0;
+    Address masterMask = 0;
+    Address slave      = 0;
+    Address slaveMask  = 0;
+    Byte control       = 0;
+    Byte controlMask   = 0;
+  };
+
+public:
+  static auto constexpr MAX_RULE_COUNT = 8;
+
+public:
+  /**
+   * Check if filter has no rules
+   * @return bool
+   */
+  [[nodiscard]] auto isEmpty() const -> bool;
+  /**
+   * Check if any rule matches the addresses. Evaluated right after the slave address field
+   * @param master Master address
+   * @param slave Slave address
+   * @return bool
+   */
+  [[nodiscard]] auto acceptsAddress(Address master, Address slave) const -> bool;
+  /**
+   * Check if any rule matches the addresses and control field. Evaluated right after the control field
+   * @param master Master address
+   * @param slave Slave address
+   * @param control Control field
+   * @return bool
+   */
+  [[nodiscard]] auto accepts(Address master, Address slave, Byte control) const -> bool;
+
+public:
+  /**
+   * Add rule
+   * @param rule Rule
+   * @return False if MAX_RULE_COUNT rules are already added
+   */
+  auto addRule(Rule const& rule) -> bool;
+  /**
+   * Add rule accepting frames from the master
+   * @param master Master address
+   * @return False if MAX_RULE_COUNT rules are already added
+   */
+  auto addMaster(Address master) -> bool;
+  /**
+   * Add rule accepting frames to the slave
+   * @param slave Slave address
+   * @return False if MAX_RULE_COUNT rules are already added
+   */
+  auto addSlave(Address slave) -> bool;
+  /**
+   * Remove all rules
+   */
+  auto clear() -> void;
+
+private:
+  static auto matchesAddress(Rule const& rule, Address master, Address slave) -> bool;
+
+private:
+  std::array<Rule, MAX_RULE_COUNT> m_rules = {};
+  Size m_ruleCount                         = 0;
+};
+
+} // namespace iebus
@@ -0,0 +1,89 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#pragma once
+
+#include <limits>
+#include <optional>
+
+#include <iebus/Frame.hpp>
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * High pulse seen on the bus
+ */
+struct Pulse {
+  Time timestamp;
+  Time highTime;
+};
+
+/**
+ * @class Backend
+ * Bus access replacing the GPIO, RMT and timer based I/O of the Driver, e.g. for simulation off-target.
+ * The backend sees every pulse on the bus including the own transmissions, like the capture receive modes
+ */
+class Backend {
+public:
+  /**
+   * Receive timeout waiting until the next pulse
+   */
+  static auto constexpr WAIT_FOREVER = std::numeric_limits<Time>::max();
+
+public:
+  virtual ~Backend() = default;
+
+public:
+  /**
+   * Get current bus time
+   * @return Microseconds on the timebase of the pulse timestamps
+   */
+  [[nodiscard]] virtual auto getTime() const -> Time = 0;
+  /**
+   * Check if bus is free for a transmission
+   * @return bool
+   */
+  [[nodiscard]] virtual auto isBusFree() const -> bool = 0;
+
+public:
+  /**
+   * Start bus access
+   * @return bool
+   */
+  virtual auto enable() -> bool = 0;
+  /**
+   * Stop bus access
+   */
+  virtual auto disable() -> void = 0;
+
+public:
+  /**
+   * Take the next pulse
+   * @param timeoutUS Wait timeout in microseconds or WAIT_FOREVER
+   * @return Pulse or nullopt on timeout
+   */
+  [[nodiscard]] virtual auto receive(Time timeoutUS) -> std::optional<Pulse> = 0;
+  /**
+   * Clock symbols out and block until the transmission is completed
+   * @param symbols Frame symbols
+   * @return bool
+   */
+  [[nodiscard]] virtual auto transmit(Frame::Symbols symbols) -> bool = 0;
+};
+
+} // namespace iebus
@@ -0,0 +1,96 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class BitTiming
+ * Classification of data bit high times.
+ * In adaptive mode measured high times are collected into a histogram and the bit timing is recentred on the learned bit 0 and bit 1 clusters
+ */
+class BitTiming {
+public:
+  struct Timing {
+    Time bit0HighUS;
+    Time bit1HighUS;
+    Time thresholdUS;
+  };
+
+public:
+  BitTiming() noexcept;
+
+public:
+  /**
+   * Check if timing is learned from the bus
+   * @return bool
+   */
+  [[nodiscard]] auto isAdaptive() const -> bool;
+  /**
+   * Get current bit timing
+   * @return Timing
+   */
+  [[nodiscard]] auto getTiming() const -> Timing;
+  /**
+   * Classify high time without learning
+   * @param highTimeUS Pulse high time
+   * @return Data bit
+   */
+  [[nodiscard]] auto classify(Time highTimeUS) const -> Bit;
+
+public:
+  /**
+   * Enable or disable learning. Disabling restores the nominal timing
+   * @param isAdaptive bool
+   */
+  auto setAdaptive(bool isAdaptive) -> void;
+  /**
+   * Classify high time, recording it in adaptive mode. Cheap enough for the bit decode path
+   * @param highTimeUS Pulse high time
+   * @return Data bit
+   */
+  auto decode(Time highTimeUS) -> Bit;
+  /**
+   * Recentre timing on the recorded high times. Called between frames
+   * @return True if timing is changed
+   */
+  auto update() -> bool;
+  /**
+   * Restore the nominal timing and drop recorded high times
+   */
+  auto reset() -> void;
+
+private:
+  static auto constexpr HISTOGRAM_SIZE = 64;
+
+private:
+  bool m_isAdaptive = false;
+  Timing m_timing;
+
+private:
+  std::array<std::uint16_t, HISTOGRAM_SIZE> m_histogram = {};
+  std::uint32_t m_sampleCount                           = 0;
+};
+
+} // namespace iebus
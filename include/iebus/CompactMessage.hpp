@@ -0,0 +1,108 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include <iebus/Message.hpp>
+#include <iebus/MessagePool.hpp>
+
+namespace iebus {
+
+/**
+ * @class CompactMessage
+ * Message with inline storage for short payloads.
+ * Longer payloads are kept in a message borrowed from an overflow pool, so the common short frame costs a few dozen bytes instead of a full Message
+ */
+class CompactMessage {
+public:
+  static auto constexpr INLINE_DATA_SIZE = 32;
+
+public:
+  CompactMessage() noexcept = default;
+
+public:
+  CompactMessage(CompactMessage&&) noexcept                    = default;
+  auto operator=(CompactMessage&&) noexcept -> CompactMessage& = default;
+
+public:
+  CompactMessage(CompactMessage const&)                    = delete;
+  auto operator=(CompactMessage const&) -> CompactMessage& = delete;
+
+public:
+  [[nodiscard]] auto getBroadcast() const -> BroadcastType;
+  [[nodiscard]] auto getMaster() const -> Address;
+  [[nodiscard]] auto getSlave() const -> Address;
+  [[nodiscard]] auto getControl() const -> Byte;
+  [[nodiscard]] auto getDataLength() const -> Size;
+  [[nodiscard]] auto getData() const -> std::span<Byte const>;
+  /**
+   * Check if payload is stored in the overflow pool
+   * @return bool
+   */
+  [[nodiscard]] auto isOverflowed() const -> bool;
+
+public:
+  /**
+   * Store the message
+   * @param message Message
+   * @param overflow Pool for payloads longer than INLINE_DATA_SIZE
+   * @return False if the payload does not fit inline and the pool is exhausted
+   */
+  auto assign(Message const& message, MessagePool& overflow) -> bool;
+  /**
+   * Store the message fields
+   * @param broadcast Broadcast type
+   * @param master Master address
+   * @param slave Slave address
+   * @param control Control field
+   * @param data Payload of 1..MAX_MESSAGE_SIZE bytes
+   * @param overflow Pool for payloads longer than INLINE_DATA_SIZE
+   * @return False if the payload does not fit inline and the pool is exhausted
+   */
+  auto assign(BroadcastType broadcast, Address master, Address slave, Byte control, std::span<Byte const> data, MessagePool& overflow) -> bool;
+  /**
+   * Expand into a full message
+   * @param message Message to fill
+   */
+  auto toMessage(Message& message) const -> void;
+
+public:
+  /**
+   * Write null terminated text form without allocation, see MessageFormatter
+   * @param buffer Destination, MessageFormatter::MAX_SIZE + 1 chars for any message
+   * @return Number of written chars without terminating null
+   */
+  [[nodiscard]] auto format(std::span<char> buffer) const -> Size;
+  [[nodiscard]] [[maybe_unused]] auto toString() const -> std::string;
+
+private:
+  BroadcastType m_broadcast                       = BroadcastType::BROADCAST;
+  Address m_master                                = 0;
+  Address m_slave                                 = 0;
+  Byte m_control                                  = 0;
+  std::uint16_t m_dataLength                      = 0;
+  std::array<Byte, INLINE_DATA_SIZE> m_inlineData = {};
+  MessagePool::Handle m_overflow;
+};
+
+} // namespace iebus
@@ -18,21 +18,91 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
 #include <optional>
+#include <span>
 
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <iebus/AcceptanceFilter.hpp>
+#include <iebus/CompactMessage.hpp>
+#include <iebus/Diagnostics.hpp>
 #include <iebus/Driver.hpp>
+#include <iebus/Field.hpp>
+#include <iebus/Frame.hpp>
 #include <iebus/Message.hpp>
+#include <iebus/MessagePool.hpp>
+#include <iebus/RingBuffer.hpp>
+#include <iebus/Segmentation.hpp>
+#include <iebus/Sniffer.hpp>
+#include <iebus/Statistics.hpp>
+#include <iebus/TransmitScheduler.hpp>
 
 namespace iebus {
 
 /**
  * @class Controller
- * IEBus Controller
+ * IEBus Controller.
+ * Bits are timed with the CPU cycle counter, which is per core. A task calling readMessage(), readStream(), readSegment() or
+ * the write functions without a running receiver must be pinned to a core, otherwise a migration corrupts the bit timing
  */
 class Controller {
+public:
+  /**
+   * Callback invoked on the receiver task for each message addressed to a local address
+   */
+  using Handler = void (*)(Message const& message, void* context);
+
+  /**
+   * Decide whether a received message goes to the bridged bus
+   */
+  using ForwardFilter = bool (*)(Message const& message, void* context);
+
+  /**
+   * Per message result of writeMessages(), bit i is set if message i is acknowledged
+   */
+  using BatchResult = std::uint32_t;
+
+  /**
+   * Callbacks of readStream() invoked on the reading task between data bytes.
+   * In ReceiveMode::POLLING they must return within a few microseconds, capture modes buffer the bus meanwhile
+   */
+  struct StreamHandler {
+    /**
+     * Frame header once the data length field is validated, data bytes are not filled. Return false to skip the frame
+     */
+    bool (*onHeader)(Message const& header, void* context);
+    /**
+     * Decoded data chunk located in the caller buffer. Return false to abort the frame, the rest is not acknowledged
+     */
+    bool (*onData)(std::span<Byte const> chunk, Size offset, void* context);
+    void* context;
+  };
 
 public:
-  Controller(Driver::Pin rx, Driver::Pin tx, Driver::Pin enable, Address address) noexcept;
+  static auto constexpr MAX_LOCAL_ADDRESS_COUNT = 8;
+  static auto constexpr MAX_BATCH_SIZE          = sizeof(BatchResult) * 8;
+
+public:
+  Controller(Driver::Pin rx, Driver::Pin tx, Driver::Pin enable, Address address, ReceiveMode receiveMode = ReceiveMode::POLLING,
+             TransmitMode transmitMode = TransmitMode::BIT_BANG) noexcept;
+  /**
+   * Controller on a bus backend, e.g. SimulatedBus
+   * @param backend Bus access, must outlive the controller
+   * @param address Own address
+   */
+  Controller(Backend& backend, Address address) noexcept;
+  ~Controller();
+
+public:
+  Controller(Controller const&)                    = delete;
+  auto operator=(Controller const&) -> Controller& = delete;
 
 public:
   /**
@@ -50,42 +120,525 @@ public:
    * @return bool
    */
   [[nodiscard]] auto isEnabled() const -> bool;
+  /**
+   * Check if background receiver task is running
+   * @return bool
+   */
+  [[nodiscard]] auto isReceiverRunning() const -> bool;
+  /**
+   * Get number of received messages dropped because the receive queue or pool was full or they could not be forwarded
+   * @return Count
+   */
+  [[nodiscard]] auto getDroppedCount() const -> std::uint32_t;
+  /**
+   * Get decode and transmit error records
+   * @return Diagnostics
+   */
+  [[nodiscard]] auto getDiagnostics() -> Diagnostics&;
+  /**
+   * Get bus statistics shared with the driver
+   * @return Statistics
+   */
+  [[nodiscard]] auto getStatistics() -> Statistics&;
+  /**
+   * Get filter of received frames. Frames addressed to this device are always accepted.
+   * Rejected frames are skipped right after the slave address or control field. Configure it before startReceiver()
+   * @return Acceptance filter
+   */
+  [[nodiscard]] auto getAcceptanceFilter() -> AcceptanceFilter&;
+  /**
+   * Check if frames to the address are acknowledged by this controller
+   * @param address Slave address
+   * @return bool
+   */
+  [[nodiscard]] auto isLocalAddress(Address address) const -> bool;
+
+public:
+  /**
+   * Acknowledge frames to one more address, e.g. to emulate several devices on the same bus.
+   * Messages to it are passed to the handler and then to its own queue instead of the shared receive queue. Call it before startReceiver()
+   * @param address Slave address
+   * @param capacity Queue capacity in messages, zero for handler only delivery
+   * @param handler Optional callback
+   * @param context Callback argument
+   * @return bool
+   */
+  auto addLocalAddress(Address address, Size capacity, Handler handler = nullptr, void* context = nullptr) -> bool;
+  /**
+   * Switch the receiver task to promiscuous capture. Every frame, including partial ones and own transmissions, is recorded into the sniffer
+   * instead of being decoded into messages. Acknowledgment slots are never driven, the acceptance filter and local addresses are ignored.
+   * Call it before startReceiver()
+   * @param sniffer Capture record stream, nullptr to disable
+   */
+  auto setSniffer(Sniffer* sniffer) -> void;
+  /**
+   * Select timing of acknowledgments for frames to this device. In AckMode::SCHEDULED the answer is decided from the addresses
+   * and the parity result before the slot and driven within it, so long frames are acknowledged reliably. Call it before startReceiver()
+   * @param ackMode Acknowledgment mode
+   * @return False if the mode is not supported by the driver modes
+   */
+  auto setAckMode(AckMode ackMode) -> bool;
+  /**
+   * Let the chip enter light sleep between frames while the receiver waits on an idle bus. The frame that wakes the chip is usually lost,
+   * see Driver::setLowPowerListen(). Call it before startReceiver()
+   * @param isLowPowerListen bool
+   * @return False if not supported by the driver mode or without power management
+   */
+  auto setLowPowerListen(bool isLowPowerListen) -> bool;
+
+public:
+  /**
+   * Start background task that continuously decodes frames into the receive queue.
+   * While it is running writeMessage() is executed by this task between frames and readMessage() is unavailable
+   * @param core Core the task is pinned to, tskNO_AFFINITY is refused on multi-core chips
+   * @param priority Task priority
+   * @param capacity Receive queue capacity in messages. Messages held by the application count against it
+   * @return bool
+   */
+  auto startReceiver(BaseType_t core, UBaseType_t priority, Size capacity) -> bool;
+  /**
+   * Start the receiver task split across two cores. The receiver task only decodes frames, drives acknowledgments and transmits,
+   * decoded messages are passed through a lock-free ring to the dispatch task that runs handlers and fills the queues.
+   * Slow handlers no longer delay the next frame. They may call writeMessage(), writeMessages() and writeSegmented(), the dispatch task
+   * then blocks until the receiver task has sent the frames and messages delivered meanwhile wait in the ring
+   * @param receiverCore Core of the bus timing critical receiver task
+   * @param dispatchCore Core of the dispatch task
+   * @param priority Priority of both tasks
+   * @param capacity Receive queue capacity in messages. Messages held by the application count against it
+   * @return bool
+   */
+  auto startPipeline(BaseType_t receiverCore, BaseType_t dispatchCore, UBaseType_t priority, Size capacity) -> bool;
+  /**
+   * Stop background receiver and dispatch tasks and free the receive queue. The message pool is kept for the next start
+   */
+  auto stopReceiver() -> void;
+
+public:
+  /**
+   * Receive on a task shared with other controllers instead of an own receiver task, see ControllerGroup.
+   * Needs a capture receive mode, the polling one busy-waits for the whole frame.
+   * Transmissions wait a few milliseconds at most for the bus to be free, so a busy bus does not stall the others of the task
+   * @param task Task that calls serviceReceiver()
+   * @param capacity Receive queue capacity in messages
+   * @return bool
+   */
+  auto attachReceiver(TaskHandle_t task, Size capacity) -> bool;
+  /**
+   * Run one receiver iteration: pending transmissions, then at most one received frame
+   * @param timeout Start bit wait timeout in ticks
+   * @return True if a frame was received
+   */
+  [[nodiscard]] auto serviceReceiver(TickType_t timeout) -> bool;
+  /**
+   * Arm the capture wakeup of the shared task before it sleeps on its notification
+   * @param timeout Longest sleep in ticks
+   * @return Sleep timeout in ticks, shortened to the next scheduled transmission, or zero if work is already pending
+   */
+  [[nodiscard]] auto prepareIdleWait(TickType_t timeout) -> TickType_t;
+  /**
+   * Fail pending transmissions and free the receive queue once the shared task no longer calls serviceReceiver()
+   */
+  auto detachReceiver() -> void;
+  /**
+   * Bridge received messages to another bus. Messages that are not addressed to a local address and pass the filter
+   * are moved to the transmit scheduler of the target without copying and are not delivered locally.
+   * They count against the receive capacity until sent. While the target receiver is stopped they are dropped
+   * and counted in the forward drop statistics. Call it before startReceiver()
+   * @param target Controller of the other bus, nullptr to disable
+   * @param filter Optional filter, nullptr to forward every message
+   * @param context Filter argument
+   * @param options Transmission options of the forwarded messages
+   */
+  auto setForwarding(Controller* target, ForwardFilter filter = nullptr, void* context = nullptr, TransmitScheduler::Options const& options = {}) -> void;
+  /**
+   * Take a received message without waiting.
+   * The message stays in the receive pool until the handle is released
+   * @return Handle, empty if there is no message
+   */
+  [[nodiscard]] auto tryRead() -> MessagePool::Handle;
+  /**
+   * Wait for a received message.
+   * The message stays in the receive pool until the handle is released
+   * @param timeout Wait timeout in ticks
+   * @return Handle, empty on timeout
+   */
+  [[nodiscard]] auto read(TickType_t timeout) -> MessagePool::Handle;
+  /**
+   * Wait for a received message addressed to the local address
+   * @param address Address added with addLocalAddress()
+   * @param timeout Wait timeout in ticks
+   * @return Handle, empty on timeout
+   */
+  [[nodiscard]] auto read(Address address, TickType_t timeout) -> MessagePool::Handle;
 
 public:
   /**
    * Read the message from IEBus
+   * @param timeout Start bit wait timeout in ticks
    * @return Optional message
    */
-  [[nodiscard]] auto readMessage() -> std::optional<Message>;
+  [[nodiscard]] auto readMessage(TickType_t timeout = portMAX_DELAY) -> std::optional<Message>;
+  /**
+   * Read the message from IEBus into a compact message
+   * @param message Message to fill
+   * @param overflow Pool for payloads longer than CompactMessage::INLINE_DATA_SIZE
+   * @param timeout Start bit wait timeout in ticks
+   * @return bool
+   */
+  [[nodiscard]] auto readMessage(CompactMessage& message, MessagePool& overflow, TickType_t timeout = portMAX_DELAY) -> bool;
+  /**
+   * Read the message from IEBus streaming its data field into the caller buffer.
+   * The header is reported as soon as the length field is received, data bytes are decoded directly into the buffer
+   * and reported in chunks while the frame is still on the bus. A buffer shorter than the data length is reused from its start
+   * @param handler Stream callbacks
+   * @param buffer Data destination
+   * @param chunkSize Number of bytes per chunk, a chunk also ends at the buffer end and at the frame end
+   * @param timeout Start bit wait timeout in ticks
+   * @return True if the whole data field is received
+   */
+  [[nodiscard]] auto readStream(StreamHandler const& handler, std::span<Byte> buffer, Size chunkSize, TickType_t timeout = portMAX_DELAY) -> bool;
+  /**
+   * Read one segment of a segmented transfer decoding its payload directly into the reassembler buffer
+   * @param reassembler Transfer state and destination
+   * @param timeout Start bit wait timeout in ticks
+   * @return Reassembler status, INVALID if no segment is received
+   */
+  [[nodiscard]] auto readSegment(Reassembler& reassembler, TickType_t timeout = portMAX_DELAY) -> Reassembler::Status;
   /**
    * Write a message to IEBus
    * @param message Message
    * @return bool
    */
   [[nodiscard]] auto writeMessage(Message const& message) -> bool;
+  /**
+   * Write a compact message to IEBus
+   * @param message Message
+   * @return bool
+   */
+  [[nodiscard]] auto writeMessage(CompactMessage const& message) -> bool;
+  /**
+   * Write several messages in one bus acquisition. The first frame waits for the free bus, the next ones follow
+   * after the minimum inter-frame gap. A failed frame does not stop the batch
+   * @param messages Up to MAX_BATCH_SIZE messages
+   * @return Result bitmap, zero if the controller is disabled or the batch is too long
+   */
+  [[nodiscard]] auto writeMessages(std::span<Message const> messages) -> BatchResult;
+  /**
+   * Write a payload longer than one frame as consecutive segment frames, see Segmentation.hpp.
+   * Segments of a window are sent back to back, the receiver task serves received frames and scheduled messages between windows
+   * @param broadcast Broadcast type
+   * @param master Master address
+   * @param slave Slave address
+   * @param control Control field of every segment
+   * @param data Payload up to MAX_SEGMENTED_SIZE bytes, must stay valid until return
+   * @param window Segments sent back to back
+   * @return False if some segment is not acknowledged after retries
+   */
+  [[nodiscard]] auto writeSegmented(BroadcastType broadcast, Address master, Address slave, Byte control, std::span<Byte const> data, Size window = 4) -> bool;
+  /**
+   * Queue a message for asynchronous transmission by the receiver task.
+   * Ready messages are sent between received frames, higher priority first, failed attempts are retried after a doubling backoff
+   * @param message Message, copied
+   * @param options Priority, retries, backoff, deadline and completion callback
+   * @return False if the receiver task is not running or the scheduler is full
+   */
+  [[nodiscard]] auto scheduleMessage(Message const& message, TransmitScheduler::Options const& options = {}) -> bool;
 
 private:
   /**
-   * Check parity for calculated parity
-   * @param data Data for check
-   * @param size Data size
-   * @param parity Etalon parity
-   * @return Comparison result
+   * Message fields with a borrowed payload of 1..MAX_MESSAGE_SIZE bytes sent as prefix followed by data
    */
-  static auto checkParity(Driver::Data data, Size size, Bit parity) -> bool;
+  struct MessageView {
+    BroadcastType broadcast;
+    Address master;
+    Address slave;
+    Byte control;
+    std::span<Byte const> data;
+    std::span<Byte const> prefix = {};
+  };
+
   /**
-   * Calculate parity for calculated parity
-   * @param data Data for calculate
-   * @param size Data size
-   * @return Parity bit
+   * Result of a request served by the receiver task. Its own semaphore keeps the task notification free for the waiting task,
+   * e.g. the dispatch task woken for every delivered message
    */
-  static auto calculateParity(Driver::Data data, Size size) -> Bit;
+  struct TransmitCompletion {
+    StaticSemaphore_t storage;
+    SemaphoreHandle_t semaphore;
+    std::uint32_t result;
+  };
+
+  struct SegmentedTransfer {
+    MessageView message;
+    Size window;
+    Size nextSegment;
+    Size segmentCount;
+    TransmitCompletion* completion;
+    bool isFailed;
+  };
+
+  struct LocalDevice {
+    Address address;
+    Size capacity;
+    Handler handler;
+    void* context;
+    QueueHandle_t queue;
+  };
+
+  struct TransmitRequest {
+    MessageView const* message;
+    SegmentedTransfer* transfer;
+    std::span<Message const> batch;
+    TransmitCompletion* completion;
+  };
+
+  struct AckContext {
+    Controller const* controller;
+    Message const* message;
+  };
+
+  struct DecodedMessage {
+    Message* message;
+    Time frameStartTime;
+  };
+
+private:
+  static auto receiverTask(void* context) -> void;
+  static auto dispatchTask(void* context) -> void;
+
+private:
+  /**
+   * Acknowledge the slave address field if it is a local address of a frame for device
+   */
+  static auto isSlaveAcknowledged(Data value, void* context) -> bool;
+  /**
+   * Acknowledge the control, length and data fields of a frame to this device
+   */
+  static auto isFieldAcknowledged(Data value, void* context) -> bool;
+
+private:
+  /**
+   * Decode a field, answering its acknowledgment slot if the message is addressed to this device.
+   * Errors are recorded in diagnostics and logged immediately only with CONFIG_IEBUS_DECODE_LOGGING
+   * @tparam FieldType Field descriptor
+   * @param destination Message member to fill
+   * @param message Message decoded so far
+   * @param field Field for the error record
+   * @param index Data byte index for the error record
+   * @return False on timeout or parity error
+   */
+  template <typename FieldType, typename T> [[nodiscard]] auto receiveField(T& destination, Message const& message, FrameField field, Size index = 0) -> bool;
+  /**
+   * Decode the message from IEBus
+   * @param message Message to fill
+   * @param timeout Start bit wait timeout in ticks
+   * @return bool
+   */
+  [[nodiscard]] auto receiveMessage(Message& message, TickType_t timeout) -> bool;
+  /**
+   * Decode the message fields following the start bit
+   * @param message Message to fill
+   * @return bool
+   */
+  [[nodiscard]] auto decodeMessage(Message& message) -> bool;
+  /**
+   * Decode the message fields following the start bit up to the data length
+   * @param message Message to fill, data bytes are left untouched
+   * @return False if a field fails or the frame is rejected by the acceptance filter
+   */
+  [[nodiscard]] auto decodeHeader(Message& message) -> bool;
+  /**
+   * Create pools and queues of the receiver
+   * @param capacity Receive queue capacity in messages
+   * @return bool
+   */
+  [[nodiscard]] auto prepareReceiver(Size capacity) -> bool;
+  /**
+   * Drain and free the receiver queues
+   */
+  auto releaseReceiver() -> void;
+  /**
+   * Record a field into the sniffer without answering its acknowledgment slot
+   * @tparam FieldType Field descriptor
+   * @param value Field value
+   * @return False on timeout
+   */
+  template <typename FieldType> [[nodiscard]] auto captureField(Data& value) -> bool;
+  /**
+   * Record the frame following the start bit into the sniffer
+   */
+  auto captureFrame() -> void;
+  /**
+   * Record the own frame into the sniffer. Acknowledgment bits reflect the overall transmission result
+   * @param message Message
+   * @param isAcknowledged Transmission result
+   */
+  auto captureTransmittedFrame(MessageView const& message, bool isAcknowledged) -> void;
+  /**
+   * Decode the frame that won the arbitration against the own transmission.
+   * On the receiver task it is queued as any received message, otherwise it is only acknowledged and dropped
+   */
+  auto receiveArbitrationWinner() -> void;
+  /**
+   * Encode and send the message to IEBus
+   * @param message Message
+   * @param isFollowing Frame follows the previous frame of a batch, the bus is only checked for the minimum inter-frame gap
+   * @return False if the frame is not acknowledged, arbitration is lost or a collision is detected
+   */
+  [[nodiscard]] auto transmitMessage(MessageView const& message, bool isFollowing = false) -> bool;
+  /**
+   * Send the batch frames back to back
+   * @param messages Messages
+   * @return Result bitmap
+   */
+  [[nodiscard]] auto transmitBatch(std::span<Message const> messages) -> BatchResult;
+  /**
+   * Transmit the message on the receiver task if it is running or on the calling task otherwise
+   * @param message Message
+   * @return bool
+   */
+  [[nodiscard]] auto submitMessage(MessageView const& message) -> bool;
+  /**
+   * Hand the decoded message to the dispatch task if it is running or dispatch it on the calling task otherwise
+   * @param message Message
+   */
+  auto deliverMessage(MessagePool::Handle message) -> void;
+  /**
+   * Pass the received message to its local device or the shared receive queue
+   * @param message Message
+   * @param frameStartTime Start bit time of the message frame
+   */
+  auto dispatchMessage(MessagePool::Handle message, Time frameStartTime) -> void;
+  /**
+   * Record latency from the start bit of the frame to its delivery
+   * @param frameStartTime Start bit time of the frame
+   */
+  auto recordLatency(Time frameStartTime) -> void;
+  /**
+   * Move the received message to the transmit scheduler of the forwarding target
+   * @param message Message
+   * @param frameStartTime Start bit time of the message frame
+   */
+  auto forwardMessage(MessagePool::Handle message, Time frameStartTime) -> void;
+  /**
+   * Count received message dropped because the receive queue or pool was full
+   */
+  auto countDropped() -> void;
+  /**
+   * Find additional local address
+   * @param address Slave address
+   * @return Device or nullptr
+   */
+  [[nodiscard]] auto findLocalDevice(Address address) const -> LocalDevice const*;
+  /**
+   * Pass write request to the receiver task and wait until it is served
+   * @param request Request, its completion is set here
+   * @return Request result, nullopt if the receiver task is not running
+   */
+  [[nodiscard]] auto requestTransmit(TransmitRequest request) -> std::optional<std::uint32_t>;
+  /**
+   * Execute pending write requests on the receiver task
+   */
+  auto serveTransmitRequests() -> void;
+  /**
+   * Send the next window of segments
+   * @param transfer Transfer
+   * @return True if more segments are pending
+   */
+  [[nodiscard]] auto transmitSegments(SegmentedTransfer& transfer) -> bool;
+  /**
+   * Transmit ready scheduled messages on the receiver task
+   */
+  auto serveScheduledMessages() -> void;
+  /**
+   * Fail pending write requests
+   */
+  auto rejectTransmitRequests() -> void;
+  /**
+   * Report result of a served write request and wake its task
+   * @param completion Completion of the request
+   * @param result Request result
+   */
+  static auto completeTransmitRequest(TransmitCompletion& completion, std::uint32_t result) -> void;
+  /**
+   * Check if the message is addressed to this device and needs acknowledgment
+   * @param message Message decoded so far
+   * @return bool
+   */
+  [[nodiscard]] auto isForThisDevice(Message const& message) const -> bool;
+  /**
+   * Push message to the transmit scheduler if the receiver is running and wake the receiver task
+   * @param message Message to transmit
+   * @param options Scheduler options
+   * @return False if the receiver is stopped or the scheduler is full
+   */
+  auto scheduleTransmit(MessagePool::Handle message, TransmitScheduler::Options const& options) -> bool;
+  /**
+   * Wake the shared receiver task on a new transmission, it may sleep on the capture wakeup. Call with the transmit lock held
+   */
+  auto wakeReceiver() -> void;
+  /**
+   * Check if the calling task is the receiver task
+   * @return bool
+   */
+  [[nodiscard]] auto isReceiverTask() const -> bool;
+  /**
+   * Check if the calling task is the dispatch task
+   * @return bool
+   */
+  [[nodiscard]] auto isDispatchTask() const -> bool;
+
+private:
+  /**
+   * Build bit level image of the message
+   * @param message Message
+   * @param frame Frame to fill
+   */
+  static auto encodeFrame(MessageView const& message, Frame& frame) -> void;
+
+private:
+  static auto constexpr ADDRESS_COUNT = 1 << SLAVE_ADDRESS_BIT_SIZE;
+  static auto constexpr ADDRESS_MASK  = ADDRESS_COUNT - 1;
+
+  static auto constexpr DISPATCH_RING_SIZE = 8;
 
 private:
   Address const m_address;
+  std::bitset<ADDRESS_COUNT> m_localAddresses;
+  std::array<LocalDevice, MAX_LOCAL_ADDRESS_COUNT> m_localDevices = {};
+  Size m_localDeviceCount                                         = 0;
 
 private:
   Driver m_driver;
+  Frame m_frame;
+  MessagePool m_messagePool;
+  MessagePool m_transmitPool;
+  TransmitScheduler m_transmitScheduler;
+  Diagnostics m_diagnostics;
+  AcceptanceFilter m_acceptanceFilter;
+  Sniffer* m_sniffer = nullptr;
+
+private:
+  StaticSemaphore_t m_transmitLockBuffer    = {};
+  SemaphoreHandle_t m_transmitLock          = nullptr;
+  TaskHandle_t m_receiverTask               = nullptr;
+  TaskHandle_t m_stoppingTask               = nullptr;
+  QueueHandle_t m_receiveQueue              = nullptr;
+  QueueHandle_t m_transmitQueue             = nullptr;
+  SegmentedTransfer* m_activeTransfer       = nullptr;
+  std::atomic<bool> m_isReceiverRunning     = false;
+  std::atomic<std::uint32_t> m_droppedCount = 0;
+
+private:
+  RingBuffer<DecodedMessage, DISPATCH_RING_SIZE> m_dispatchRing;
+  TaskHandle_t m_dispatchTask           = nullptr;
+  std::atomic<bool> m_isDispatchRunning = false;
+  bool m_isReceiverAttached             = false;
+
+private:
+  Controller* m_forwardTarget                 = nullptr;
+  ForwardFilter m_forwardFilter               = nullptr;
+  void* m_forwardContext                      = nullptr;
+  TransmitScheduler::Options m_forwardOptions = {};
 };
 
 } // namespace iebus
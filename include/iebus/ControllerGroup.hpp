@@ -0,0 +1,93 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <iebus/Controller.hpp>
+
+namespace iebus {
+
+/**
+ * @class ControllerGroup
+ * Several buses served by a single receiver task, e.g. two vehicle segments bridged by one chip.
+ * Every controller keeps its own driver, RMT channels or edge capture and message pool, the task polls them in turn
+ * and sleeps on its notification when none of them has work. A finished RMT capture, an RX edge or a new transmission wakes it.
+ * Without CONFIG_RMT_RECV_FUNC_IN_IRAM the RMT capture is restarted only once the task is awake, so its wakeup latency
+ * still has to stay below the gap between two frames
+ */
+class ControllerGroup {
+public:
+  static auto constexpr MAX_CONTROLLER_COUNT = 4;
+
+public:
+  ControllerGroup() noexcept = default;
+  ~ControllerGroup();
+
+public:
+  ControllerGroup(ControllerGroup const&)                    = delete;
+  auto operator=(ControllerGroup const&) -> ControllerGroup& = delete;
+
+public:
+  /**
+   * Check if the group task is running
+   * @return bool
+   */
+  [[nodiscard]] auto isRunning() const -> bool;
+
+public:
+  /**
+   * Add controller to the group. Call it before start()
+   * @param controller Enabled controller in a capture receive mode
+   * @return False if the group is full or running
+   */
+  auto add(Controller& controller) -> bool;
+
+public:
+  /**
+   * Start the task receiving on all controllers of the group
+   * @param core Core the task is pinned to, tskNO_AFFINITY is refused on multi-core chips
+   * @param priority Task priority
+   * @param capacity Receive queue capacity of each controller in messages
+   * @return bool
+   */
+  auto start(BaseType_t core, UBaseType_t priority, Size capacity) -> bool;
+  /**
+   * Stop the group task and detach all controllers
+   */
+  auto stop() -> void;
+
+private:
+  static auto serviceTask(void* context) -> void;
+
+private:
+  std::array<Controller*, MAX_CONTROLLER_COUNT> m_controllers = {};
+  Size m_controllerCount                                      = 0;
+
+private:
+  TaskHandle_t m_task           = nullptr;
+  TaskHandle_t m_stoppingTask   = nullptr;
+  std::atomic<bool> m_isRunning = false;
+};
+
+} // namespace iebus
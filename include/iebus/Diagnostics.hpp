@@ -0,0 +1,144 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <iebus/Message.hpp>
+#include <iebus/RingBuffer.hpp>
+
+namespace iebus {
+
+enum class DiagnosticError : std::uint8_t {
+  FIELD_TIMEOUT    = 0,
+  PARITY_ERROR     = 1,
+  NO_ACK           = 2,
+  ARBITRATION_LOST = 3,
+  COLLISION        = 4,
+};
+
+enum class FrameField : std::uint8_t {
+  NONE           = 0,
+  BROADCAST      = 1,
+  MASTER_ADDRESS = 2,
+  SLAVE_ADDRESS  = 3,
+  CONTROL        = 4,
+  DATA_LENGTH    = 5,
+  DATA           = 6,
+};
+
+/**
+ * @class Diagnostics
+ * Deferred error reporting.
+ * The decode path only bumps a counter and stores a small event, formatting and logging are done later by a low priority task
+ */
+class Diagnostics {
+public:
+  struct Event {
+    Time timestamp;
+    DiagnosticError error;
+    FrameField field;
+    std::uint16_t index;
+  };
+
+public:
+  Diagnostics() noexcept = default;
+  ~Diagnostics();
+
+public:
+  Diagnostics(Diagnostics const&)                    = delete;
+  auto operator=(Diagnostics const&) -> Diagnostics& = delete;
+
+public:
+  /**
+   * Get number of recorded errors of the type
+   * @param error Error type
+   * @return Count
+   */
+  [[nodiscard]] auto getCount(DiagnosticError error) const -> std::uint32_t;
+  /**
+   * Get number of events lost because the event ring was full
+   * @return Count
+   */
+  [[nodiscard]] auto getLostCount() const -> std::uint32_t;
+  /**
+   * Check if logger task is running
+   * @return bool
+   */
+  [[nodiscard]] auto isLoggerRunning() const -> bool;
+
+public:
+  /**
+   * Record an error. Safe to call from the decode path of a single task
+   * @param error Error type
+   * @param field Frame field the error belongs to
+   * @param index Data byte index for FrameField::DATA
+   */
+  auto record(DiagnosticError error, FrameField field, Size index = 0) -> void;
+  /**
+   * Take the oldest recorded event. Must not be mixed with a running logger task
+   * @return Optional event
+   */
+  [[nodiscard]] auto takeEvent() -> std::optional<Event>;
+  /**
+   * Log all recorded events
+   */
+  auto logEvents() -> void;
+  /**
+   * Reset counters
+   */
+  auto resetCounters() -> void;
+
+public:
+  /**
+   * Start task that periodically logs recorded events
+   * @param priority Task priority, lower than the receiver task
+   * @return bool
+   */
+  auto startLogger(UBaseType_t priority = tskIDLE_PRIORITY + 1) -> bool;
+  /**
+   * Stop logger task
+   */
+  auto stopLogger() -> void;
+
+private:
+  static auto loggerTask(void* context) -> void;
+
+private:
+  static auto constexpr EVENT_COUNT = 32;
+  static auto constexpr ERROR_COUNT = 5;
+
+private:
+  RingBuffer<Event, EVENT_COUNT> m_events;
+  std::array<std::atomic<std::uint32_t>, ERROR_COUNT> m_counts = {};
+  std::atomic<std::uint32_t> m_lostCount                       = 0;
+
+private:
+  TaskHandle_t m_loggerTask           = nullptr;
+  TaskHandle_t m_stoppingTask         = nullptr;
+  std::atomic<bool> m_isLoggerRunning = false;
+};
+
+} // namespace iebus
@@ -0,0 +1,125 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <freertos/FreeRTOS.h>
+
+#include <iebus/Controller.hpp>
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class Dispatcher
+ * Routing of received messages to handlers subscribed on (master, slave, control).
+ * Subscriptions are added at startup and sorted once by build(), each message is then looked up by binary search per used wildcard combination.
+ * All handlers of a message get the same pooled message without copying
+ */
+class Dispatcher {
+public:
+  using Handler = void (*)(Message const& message, void* context);
+
+public:
+  /**
+   * Wildcard for the master or slave address
+   */
+  static auto constexpr ANY_ADDRESS = Address{0xFFFF};
+  /**
+   * Wildcard for the control field
+   */
+  static auto constexpr ANY_CONTROL = Byte{0xFF};
+
+  static auto constexpr MAX_SUBSCRIPTION_COUNT = 32;
+
+public:
+  /**
+   * Check if routing table is built
+   * @return bool
+   */
+  [[nodiscard]] auto isBuilt() const -> bool;
+  /**
+   * Get number of subscriptions
+   * @return Count
+   */
+  [[nodiscard]] auto getSubscriptionCount() const -> Size;
+
+public:
+  /**
+   * Add subscription. Handlers of a message are called grouped by wildcard combination: exact matches first, then ANY master,
+   * ANY slave, ANY master and slave, followed by the same four with ANY control. Within a group they are called in subscription order
+   * @param master Master address or ANY_ADDRESS
+   * @param slave Slave address or ANY_ADDRESS
+   * @param control Control field or ANY_CONTROL
+   * @param handler Callback
+   * @param context Callback argument
+   * @return False if the table is built or full
+   */
+  auto subscribe(Address master, Address slave, Byte control, Handler handler, void* context = nullptr) -> bool;
+  /**
+   * Sort the routing table. No subscriptions can be added afterwards
+   */
+  auto build() -> void;
+
+public:
+  /**
+   * Call handlers subscribed on the message
+   * @param message Message
+   * @return Number of called handlers
+   */
+  auto dispatch(Message const& message) const -> Size;
+  /**
+   * Wait for a message of the controller receiver task and dispatch it. The message is released after the last handler returns
+   * @param controller Controller with a running receiver task
+   * @param timeout Wait timeout in ticks
+   * @return False on timeout
+   */
+  auto dispatch(Controller& controller, TickType_t timeout) const -> bool;
+
+private:
+  struct Subscription {
+    std::uint32_t key;
+    Handler handler;
+    void* context;
+    std::uint8_t pattern;
+  };
+
+private:
+  /**
+   * Wildcard bits of a subscription
+   */
+  static auto constexpr ANY_MASTER_BIT  = 1 << 0;
+  static auto constexpr ANY_SLAVE_BIT   = 1 << 1;
+  static auto constexpr ANY_CONTROL_BIT = 1 << 2;
+  static auto constexpr PATTERN_COUNT   = 8;
+
+private:
+  static auto makeKey(Address master, Address slave, Byte control) -> std::uint32_t;
+  static auto maskKey(std::uint32_t key, std::uint8_t pattern) -> std::uint32_t;
+
+private:
+  std::array<Subscription, MAX_SUBSCRIPTION_COUNT> m_subscriptions = {};
+  Size m_subscriptionCount                                         = 0;
+  std::array<std::uint8_t, PATTERN_COUNT + 1> m_patternBegin       = {};
+  std::uint8_t m_patternMask                                       = 0;
+  bool m_isBuilt                                                   = false;
+};
+
+} // namespace iebus
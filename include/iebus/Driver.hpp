@@ -18,8 +18,26 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <optional>
+#include <utility>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <iebus/Backend.hpp>
+#include <iebus/BitTiming.hpp>
+#include <iebus/EdgeCapture.hpp>
+#include <iebus/Field.hpp>
+#include <iebus/Frame.hpp>
+#include <iebus/IdleDetector.hpp>
 #include <iebus/Message.hpp>
+#include <iebus/PowerLock.hpp>
+#include <iebus/RmtReceiver.hpp>
+#include <iebus/RmtTransmitter.hpp>
+#include <iebus/Statistics.hpp>
 
 namespace iebus {
 
@@ -28,6 +46,90 @@ enum class AcknowledgmentType : Bit {
   NAK = 1,
 };
 
+/**
+ * Source of the received bit timings
+ */
+enum class ReceiveMode {
+  /**
+   * Bit timings are measured by polling of the RX pin
+   */
+  POLLING,
+  /**
+   * Edges are captured by the RMT peripheral and decoded from a buffer.
+   * Captured frames are decoded after the fact, so acknowledgments are never driven in this mode.
+   */
+  RMT,
+  /**
+   * Edges are timestamped by the RX pin interrupt into a lock-free ring and decoded by the reading task.
+   * Acknowledgments are never driven in this mode.
+   */
+  INTERRUPT,
+  /**
+   * Pulses are taken from a Backend. Acknowledgments are never driven in this mode.
+   */
+  BACKEND,
+};
+
+/**
+ * Source of the transmitted bit timings
+ */
+enum class TransmitMode {
+  /**
+   * TX pin is toggled by the CPU with busy-wait delays
+   */
+  BIT_BANG,
+  /**
+   * Whole frame is clocked out by the RMT peripheral while the task is blocked.
+   * Acknowledgment slots are checked on the captured echo, so ReceiveMode::RMT or ReceiveMode::INTERRUPT is required
+   */
+  RMT,
+  /**
+   * Whole frame is passed to a Backend, acknowledgment slots are checked on its echo
+   */
+  BACKEND,
+};
+
+/**
+ * Timing of the acknowledgment driven for frames to this device
+ */
+enum class AckMode {
+  /**
+   * Acknowledgment slot is received first and the answer is sent afterwards as a separate bit
+   */
+  DEFERRED,
+  /**
+   * Answer is decided between the parity bit and the slot, then driven from the rising edge of the slot by a cycle timed IRAM routine.
+   * Needs ReceiveMode::POLLING and TransmitMode::BIT_BANG
+   */
+  SCHEDULED,
+};
+
+/**
+ * Outcome of a frame transmission
+ */
+enum class TransmitResult {
+  /**
+   * Every acknowledgment slot is ACK
+   */
+  ACKNOWLEDGED,
+  /**
+   * Some acknowledgment slot is NAK
+   */
+  NOT_ACKNOWLEDGED,
+  /**
+   * Another master won the arbitration. The transmission was stopped and the winning frame can be received
+   */
+  ARBITRATION_LOST,
+  /**
+   * Echo of the frame differs from the transmitted bits
+   */
+  COLLISION,
+  /**
+   * Transmitter failure
+   */
+  FAILED,
+};
+
 /**
  * @class Driver
  * IEBus Driver
@@ -35,10 +137,26 @@ enum class AcknowledgmentType : Bit {
 class Driver {
 public:
   using Pin  = std::uint8_t;
-  using Data = std::uint16_t;
+  using Data = iebus::Data;
+
+  /**
+   * Decide whether to acknowledge the field, called between its parity bit and acknowledgment slot
+   */
+  using AckDecision = bool (*)(Data value, void* context);
+
+  struct FieldData {
+    Data data;
+    bool isParityValid;
+    AcknowledgmentType acknowledgment;
+  };
 
 public:
-  Driver(Pin rx, Pin tx, Pin enable) noexcept;
+  Driver(Pin rx, Pin tx, Pin enable, ReceiveMode receiveMode = ReceiveMode::POLLING, TransmitMode transmitMode = TransmitMode::BIT_BANG) noexcept;
+  /**
+   * Driver on a bus backend instead of the GPIO pins, ReceiveMode::BACKEND and TransmitMode::BACKEND are used
+   * @param backend Bus access, must outlive the driver
+   */
+  explicit Driver(Backend& backend) noexcept;
 
 public:
   /**
@@ -46,6 +164,46 @@ public:
    * @return bool
    */
   [[nodiscard]] auto isEnabled() const -> bool;
+  /**
+   * Get source of the received bit timings
+   * @return Receive mode
+   */
+  [[nodiscard]] auto getReceiveMode() const -> ReceiveMode;
+  /**
+   * Get source of the transmitted bit timings
+   * @return Transmit mode
+   */
+  [[nodiscard]] auto getTransmitMode() const -> TransmitMode;
+  /**
+   * Check if bit timing is learned from the bus
+   * @return bool
+   */
+  [[nodiscard]] auto isAdaptiveTiming() const -> bool;
+  /**
+   * Get timing of the driven acknowledgments
+   * @return Acknowledgment mode
+   */
+  [[nodiscard]] auto getAckMode() const -> AckMode;
+  /**
+   * Check if light sleep is allowed while the bus is idle
+   * @return bool
+   */
+  [[nodiscard]] auto isLowPowerListen() const -> bool;
+  /**
+   * Get bit timing used to decode and transmit data bits
+   * @return Timing
+   */
+  [[nodiscard]] auto getBitTiming() const -> BitTiming::Timing;
+  /**
+   * Get start bit time of the last received or transmitted frame
+   * @return Microseconds since boot
+   */
+  [[nodiscard]] auto getFrameStartTime() const -> Time;
+  /**
+   * Get time on the timebase of the received pulses and the frame start time
+   * @return Microseconds
+   */
+  [[nodiscard]] auto getBusTime() const -> Time;
   /**
    * Check if IEBus is high
    * @return bool
@@ -64,7 +222,38 @@ public:
 
 public:
   /**
-   * Enable IEBus transmitter
+   * Get bus statistics
+   * @return Statistics
+   */
+  [[nodiscard]] auto getStatistics() -> Statistics&;
+
+public:
+  /**
+   * Learn bit timing from the received high times. Decode threshold and transmitted high times follow the bus between frames.
+   * Disabling restores the nominal timing
+   * @param isAdaptive bool
+   */
+  auto setAdaptiveTiming(bool isAdaptive) -> void;
+  /**
+   * Select timing of the driven acknowledgments
+   * @param ackMode Acknowledgment mode
+   * @return False if the mode is not supported by the receive and transmit modes
+   */
+  auto setAckMode(AckMode ackMode) -> bool;
+  /**
+   * Let the chip enter light sleep while the bus is idle. The RX pin wakes it on the rising edge of the next start bit, the power locks
+   * are taken in the pin interrupt and held until the bus has been quiet for the listen hold time.
+   * Waking typically takes several hundred microseconds, longer than the start bit, so the frame that wakes the chip is usually lost
+   * and counted as a wakeup miss. A master repeats an unacknowledged frame to this device and the repeat is received while awake,
+   * a broadcast frame after a quiet bus is lost. Needs ReceiveMode::POLLING and CONFIG_PM_ENABLE
+   * @param isLowPowerListen bool
+   * @return False if the mode is not supported
+   */
+  auto setLowPowerListen(bool isLowPowerListen) -> bool;
+
+public:
+  /**
+   * Enable IEBus transmitter. TransmitMode::RMT with ReceiveMode::POLLING is refused and the driver stays disabled
    */
   auto enable() -> void;
   /**
@@ -74,66 +263,324 @@ public:
 
 public:
   /**
-   * Send start bit to IEBus
+   * Block until the bus is free without spinning. The calling task sleeps on its notification
+   * until the RX line has been low for one data bit period, signalled by the edge interrupt and a one-shot timer
+   * @param timeout Wait timeout in ticks
+   * @return False on timeout or if the driver is disabled
+   */
+  [[nodiscard]] auto waitBusFree(TickType_t timeout = portMAX_DELAY) -> bool;
+  /**
+   * Let the next captured pulse give the task notification once, for a task serving several drivers.
+   * Needs ReceiveMode::RMT or ReceiveMode::INTERRUPT
+   * @param task Task to notify
+   * @return False if pulses are already pending or the receive mode has no capture, the task must not wait
+   */
+  [[nodiscard]] auto armWakeup(TaskHandle_t task) -> bool;
+
+public:
+  /**
+   * Wait start bit from IEBus.
+   * In polling mode the idle bus is awaited on the RX pin interrupt with the notification of the calling task
+   * @param timeout Wait timeout in ticks
+   * @return False if no valid start bit is received before timeout
    */
-  [[nodiscard]] auto receiveStartBit() -> bool;
+  [[nodiscard]] auto receiveStartBit(TickType_t timeout = portMAX_DELAY) -> bool;
   /**
    * Get single bit from IEBus
-   * @return Data bit
+   * @return Data bit or nullopt on edge timeout
    */
-  [[nodiscard]] auto receiveBit() -> Bit;
+  [[nodiscard]] auto receiveBit() -> std::optional<Bit>;
   /**
    * Get bits data from IEBus
    * @param numBits data size
-   * @return Data bits
+   * @return Data bits or nullopt on edge timeout
+   */
+  [[nodiscard]] auto receiveBits(Size numBits) -> std::optional<Data>;
+  /**
+   * Get field bits with its parity bit and acknowledgment slot from IEBus.
+   * Bit reads are unrolled and parity is accumulated while the bits arrive.
+   * In AckMode::SCHEDULED a valid field is acknowledged in its slot when the decision returns true
+   * @tparam FieldType Field descriptor
+   * @param decision Acknowledgment decision or nullptr to only observe the slot
+   * @param context Decision context
+   * @return Field value with parity check result, NAK for fields without acknowledgment slot, or nullopt on edge timeout
    */
-  [[nodiscard]] auto receiveBits(Size numBits) -> Data;
+  template <typename FieldType> [[nodiscard]] auto receiveField(AckDecision decision = nullptr, void* context = nullptr) -> std::optional<FieldData>;
   /**
    * Wait ack from IEBus
-   * @return Ack value
+   * @return Ack value or nullopt on edge timeout
    */
-  [[nodiscard]] auto receiveAckBit() -> AcknowledgmentType;
+  [[nodiscard]] auto receiveAckBit() -> std::optional<AcknowledgmentType>;
+  /**
+   * Drive ACK from the rising edge of the acknowledgment slot, timed by the CPU cycle counter
+   * @return ACK or nullopt on edge timeout
+   */
+  [[nodiscard]] auto driveAckBit() -> std::optional<AcknowledgmentType>;
+  /**
+   * Slot part of driveAckBit(). Runs from IRAM with register pin access and the cycle counter only,
+   * so durations are converted by the caller before the slot
+   * @param holdCycles High time of a 0 bit in CPU cycles
+   * @param timeoutCycles Edge timeout in CPU cycles
+   * @return Cycles from the slot edge until the bus is released, 0 on edge timeout
+   */
+  [[nodiscard]] auto driveAckSlot(std::uint32_t holdCycles, std::uint32_t timeoutCycles) const -> std::uint32_t;
+  /**
+   * Drop the rest of the current frame without decoding.
+   * In polling mode returns once the bus is idle, in capture modes the remaining pulses are skipped by the next receiveStartBit()
+   */
+  auto skipFrame() -> void;
 
 public:
   /**
    * Get start bit from IEBus
    * @return
    */
-  auto transmitStartBit() const -> void;
+  auto transmitStartBit() -> void;
   /**
    * Send bit to IEBus
    * @param bit single bit data
    */
-  auto transmitBit(Bit bit) const -> void;
+  auto transmitBit(Bit bit) -> void;
   /**
    * Send data bits to IEBus
    * @param data data bits
    * @param numBits data size
    */
-  auto transmitBits(Data data, Size numBits) const -> void;
+  auto transmitBits(Data data, Size numBits) -> void;
   /**
    * Send ack to IEBus
    * @param ack ack value
    */
-  auto sendAckBit(AcknowledgmentType ack) const -> void;
+  auto sendAckBit(AcknowledgmentType ack) -> void;
+  /**
+   * Send whole frame to IEBus
+   * @param frame Frame symbols
+   * In bit-bang mode the RX line is sampled during the arbitration bits and the transmission stops as soon as a bit is lost.
+   * The bits seen so far are then replayed by receiveBit(), so the rest of the winning frame is decoded without a start bit
+   * @return Transmission result
+   */
+  [[nodiscard]] auto transmitFrame(Frame const& frame) -> TransmitResult;
+
+private:
+  /**
+   * Find the next start bit in the captured pulses
+   * @param timeout Wait timeout in ticks
+   * @return bool
+   */
+  [[nodiscard]] auto receiveCapturedStartBit(TickType_t timeout) -> bool;
+  /**
+   * Take the next pulse of the current frame
+   * @return Optional pulse, nullopt if the frame is over
+   */
+  [[nodiscard]] auto receiveFramePulse() -> std::optional<Pulse>;
+  /**
+   * Take the next captured pulse from the active capture backend
+   * @param timeout Wait timeout in ticks
+   * @return Optional pulse
+   */
+  [[nodiscard]] auto takePulse(TickType_t timeout) -> std::optional<Pulse>;
+  /**
+   * Take the next pulse of the current RMT capture
+   * @return Optional pulse
+   */
+  [[nodiscard]] auto nextCapturedPulse() -> std::optional<Pulse>;
+  /**
+   * Take the next RMT pulse, waiting for the next capture if the current one is exhausted
+   * @param timeout Wait timeout in ticks
+   * @return Optional pulse
+   */
+  [[nodiscard]] auto waitCapturedPulse(TickType_t timeout) -> std::optional<Pulse>;
+  /**
+   * Take the next pulse built from interrupt captured edges
+   * @param timeout Wait timeout in ticks
+   * @return Optional pulse
+   */
+  [[nodiscard]] auto waitEdgePulse(TickType_t timeout) -> std::optional<Pulse>;
+  /**
+   * Check bits and acknowledgment slots of the transmitted frame on its captured echo
+   * @param symbols Transmitted symbols
+   * @return Transmission result
+   */
+  [[nodiscard]] auto receiveTransmitEcho(Frame::Symbols symbols) -> TransmitResult;
+  /**
+   * Send arbitration bit reading the bus back at the sample point
+   * @param bit Data bit
+   * @return False if a dominant bit of another master is seen while sending bit 1
+   */
+  [[nodiscard]] auto transmitArbitrationBit(Bit bit) -> bool;
+  /**
+   * Switch to receiving of the frame that won the arbitration
+   * @param symbols Transmitted symbols
+   * @param lostIndex Symbol index of the lost bit
+   */
+  auto receiveArbitrationWinner(Frame::Symbols symbols, Size lostIndex) -> void;
+  /**
+   * Check if the start bit has been transmitted by this driver
+   * @param timestamp Start bit timestamp
+   * @return bool
+   */
+  [[nodiscard]] auto isTransmitEcho(Time timestamp) const -> bool;
+
+private:
+  /**
+   * Send symbols with the RMT transmitter or the backend
+   * @param symbols Frame symbols
+   * @return bool
+   */
+  [[nodiscard]] auto transmitSymbols(Frame::Symbols symbols) -> bool;
+  /**
+   * Pass the learned bit timing to the RMT transmitter
+   */
+  auto applyBitTiming() -> void;
+  /**
+   * Send single symbol with the RMT transmitter or the backend
+   * @param symbol Frame symbol
+   */
+  auto transmitSymbol(Symbol symbol) -> void;
 
 private:
   /**
-   * Wait before IEBus is change to low level
+   * Shift next bit into field value and parity
+   * @param data Field value
+   * @param parity Accumulated parity
+   * @return False on edge timeout
+   */
+  [[nodiscard]] auto receiveFieldBit(Data& data, Bit& parity) -> bool;
+
+private:
+  /**
+   * Block until the rising edge of the idle bus
+   * @param timeout Wait timeout in ticks
+   * @return Edge timestamp or nullopt on timeout
+   */
+  [[nodiscard]] auto waitRisingEdge(TickType_t timeout) -> std::optional<Time>;
+  /**
+   * Sleep on the task notification until the RX pin interrupt
+   * @param timeout Wait timeout in ticks
+   * @return False on timeout
    */
-  auto waitBusLow() -> void;
+  [[nodiscard]] auto waitEdgeInterrupt(TickType_t timeout) -> bool;
   /**
-   * Wait before IEBus is change to high level
+   * Release the power locks and wait for the RX pin to wake the chip from light sleep
+   * @param timeout Wait timeout in ticks
+   * @return False on timeout
    */
-  auto waitBusHigh() -> void;
+  [[nodiscard]] auto waitWakeupEdge(TickType_t timeout) -> bool;
+  /**
+   * Spin until the bus is free, used by the backend and when the idle detector is unavailable
+   * @param timeout Wait timeout in ticks
+   * @return False on timeout
+   */
+  [[nodiscard]] auto pollBusFree(TickType_t timeout) const -> bool;
+  /**
+   * Wait before IEBus is change to low level, timed by the CPU cycle counter
+   * @param timeoutUS Wait timeout
+   * @return False on timeout
+   */
+  [[nodiscard]] auto waitBusLow(Time timeoutUS) const -> bool;
+  /**
+   * Wait before IEBus is change to high level, timed by the CPU cycle counter
+   * @param timeoutUS Wait timeout
+   * @return False on timeout
+   */
+  [[nodiscard]] auto waitBusHigh(Time timeoutUS) const -> bool;
+
+private:
+  static auto onEdge(void* context) -> void;
+  static auto onCapturedEdge(Bit level, void* context) -> void;
 
 private:
   Pin const m_rxPin;
   Pin const m_txPin;
   Pin const m_enablePin;
+  ReceiveMode const m_receiveMode;
+  TransmitMode const m_transmitMode;
+  Backend* const m_backend = nullptr;
+
+private:
+  bool m_isEnabled      = false;
+  Time m_frameStartTime = 0;
+  AckMode m_ackMode     = AckMode::DEFERRED;
+  BitTiming m_bitTiming;
+  Statistics m_statistics;
 
 private:
-  bool m_isEnabled = false;
+  std::atomic<TaskHandle_t> m_edgeWaitingTask = nullptr;
+  Time m_edgeTime                             = 0;
+
+private:
+  RmtReceiver m_rmtReceiver;
+  std::optional<RmtReceiver::Capture> m_capture = std::nullopt;
+  Size m_captureIndex                           = 0;
+  Time m_captureTime                            = 0;
+  bool m_isFrameCaptured                        = false;
+  std::optional<Pulse> m_pendingPulse           = std::nullopt;
+  Time m_lastPulseEnd                           = 0;
+  std::optional<Time> m_transmitStartTime       = std::nullopt;
+
+private:
+  EdgeCapture m_edgeCapture;
+  std::array<EdgeCapture::Edge, 64> m_edges = {};
+  Size m_edgeIndex                          = 0;
+  Size m_edgeCount                          = 0;
+  std::optional<Time> m_riseTime            = std::nullopt;
+
+private:
+  IdleDetector m_idleDetector;
+
+private:
+  PowerLock m_powerLock;
+  bool m_isLowPowerListen   = false;
+  bool m_isWakeupEdge       = false;
+  TickType_t m_activityTick = 0;
+
+private:
+  RmtTransmitter m_rmtTransmitter;
+
+private:
+  std::array<Bit, BROADCAST_BIT_SIZE + MASTER_ADDRESS_BIT_SIZE> m_replayBits = {};
+  Size m_replayIndex                                                         = 0;
+  Size m_replayCount                                                         = 0;
 };
 
+template <typename FieldType> auto Driver::receiveField(AckDecision const decision, void* const context) -> std::optional<FieldData> {
+  FieldData field = {
+      .data           = 0,
+      .isParityValid  = true,
+      .acknowledgment = AcknowledgmentType::NAK,
+  };
+
+  Bit parity = 0;
+
+  auto const isReceived = [&]<Size... I>(std::index_sequence<I...>) {
+    return ((static_cast<void>(I), receiveFieldBit(field.data, parity)) and ...);
+  }(std::make_index_sequence<FieldType::BIT_SIZE>{});
+
+  if (not isReceived) {
+    return std::nullopt;
+  }
+
+  if constexpr (FieldType::HAS_PARITY) {
+    auto const parityBit = receiveBit();
+    if (not parityBit) {
+      return std::nullopt;
+    }
+
+    field.isParityValid = parity == *parityBit;
+  }
+
+  if constexpr (FieldType::HAS_ACK) {
+    auto const isScheduled    = m_ackMode == AckMode::SCHEDULED and decision != nullptr and not m_isFrameCaptured;
+    auto const isDriven       = isScheduled and field.isParityValid and decision(field.data, context);
+    auto const acknowledgment = isDriven ? driveAckBit() : receiveAckBit();
+    if (not acknowledgment) {
+      return std::nullopt;
+    }
+
+    field.acknowledgment = *acknowledgment;
+  }
+
+  return field;
+}
+
 } // namespace iebus
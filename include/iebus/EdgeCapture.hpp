@@ -0,0 +1,137 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <span>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <iebus/Message.hpp>
+#include <iebus/RingBuffer.hpp>
+
+namespace iebus {
+
+/**
+ * @class EdgeCapture
+ * Interrupt driven capture of the IEBus RX line edges.
+ * The ISR timestamps every edge into a lock-free ring which is drained by the decoding task in batches
+ */
+class EdgeCapture {
+public:
+  using Pin = std::uint8_t;
+
+  struct Edge {
+    Time timestamp;
+    Bit level;
+  };
+
+  /**
+   * Edge observer invoked from the ISR
+   */
+  using EdgeHandler = void (*)(Bit level, void* context);
+
+public:
+  explicit EdgeCapture(Pin rx) noexcept;
+  ~EdgeCapture();
+
+public:
+  EdgeCapture(EdgeCapture const&)                    = delete;
+  auto operator=(EdgeCapture const&) -> EdgeCapture& = delete;
+
+public:
+  /**
+   * Check if edge interrupt is installed
+   * @return bool
+   */
+  [[nodiscard]] auto isEnabled() const -> bool;
+  /**
+   * Get number of edges dropped because the ring was full
+   * @return Count
+   */
+  [[nodiscard]] auto getOverflowCount() const -> std::uint32_t;
+
+public:
+  /**
+   * Set observer of every captured edge. Must be set while the capture is disabled
+   * @param handler ISR safe handler or nullptr
+   * @param context Handler context
+   */
+  auto setEdgeHandler(EdgeHandler handler, void* context) -> void;
+
+public:
+  /**
+   * Install edge interrupt on the RX pin
+   * @return bool
+   */
+  auto enable() -> bool;
+  /**
+   * Remove edge interrupt from the RX pin
+   */
+  auto disable() -> void;
+
+public:
+  /**
+   * Take captured edges, blocking with the notification of the calling task while the ring is empty
+   * @param edges Destination
+   * @param timeout Wait timeout in ticks
+   * @return Number of taken edges
+   */
+  [[nodiscard]] auto receive(std::span<Edge> edges, TickType_t timeout) -> Size;
+  /**
+   * Let the next edge give the task notification once, for a task waiting on several captures
+   * @param task Task to wake
+   * @return False if edges are already pending and the task must not wait
+   */
+  [[nodiscard]] auto armWakeup(TaskHandle_t task) -> bool;
+
+private:
+  /**
+   * Edge timestamp in microseconds shifted left by one with the line level in the lowest bit
+   */
+  using PackedEdge = std::uint32_t;
+
+private:
+  static auto onEdge(void* context) -> void;
+
+private:
+  auto takeEdges(std::span<Edge> edges) -> Size;
+
+private:
+  static auto constexpr CAPACITY = 1024;
+
+private:
+  Pin const m_rxPin;
+
+private:
+  bool m_isEnabled          = false;
+  EdgeHandler m_edgeHandler = nullptr;
+  void* m_edgeContext       = nullptr;
+
+private:
+  RingBuffer<PackedEdge, CAPACITY> m_edges;
+  std::array<PackedEdge, 64> m_batch         = {};
+  std::atomic<TaskHandle_t> m_waitingTask    = nullptr;
+  std::atomic<std::uint32_t> m_overflowCount = 0;
+};
+
+} // namespace iebus
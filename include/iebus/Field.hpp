@@ -0,0 +1,79 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <utility>
+
+#include <iebus/Frame.hpp>
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @struct Field
+ * Compile time descriptor of an IEBus frame field
+ * @tparam Bits Number of data bits, sent most significant bit first
+ * @tparam HasParity Field is followed by an even parity bit
+ * @tparam HasAck Field is followed by an acknowledgment slot
+ */
+template <Size Bits, bool HasParity, bool HasAck> struct Field {
+  static_assert(Bits > 0 and Bits <= sizeof(Data) * 8, "Field does not fit into Data");
+
+  static auto constexpr BIT_SIZE   = Bits;
+  static auto constexpr HAS_PARITY = HasParity;
+  static auto constexpr HAS_ACK    = HasAck;
+  static auto constexpr MASK       = static_cast<Data>((1U << Bits) - 1);
+
+  /**
+   * Calculate even parity of the field bits
+   * @param data Field value
+   * @return Parity bit
+   */
+  [[nodiscard]] static constexpr auto calculateParity(Data const data) -> Bit {
+    return static_cast<Bit>(__builtin_parity(data & MASK));
+  }
+
+  /**
+   * Append field bits, parity bit and acknowledgment slot
+   * @param data Field value
+   * @param frame Frame to fill
+   */
+  static auto encode(Data const data, Frame& frame) -> void {
+    [&]<Size... I>(std::index_sequence<I...>) {
+      (frame.appendBit(static_cast<Bit>(data >> (Bits - 1 - I) & 1)), ...);
+    }(std::make_index_sequence<Bits>{});
+
+    if constexpr (HasParity) {
+      frame.appendBit(calculateParity(data));
+    }
+
+    if constexpr (HasAck) {
+      frame.appendAckSlot();
+    }
+  }
+};
+
+using BroadcastField     = Field<BROADCAST_BIT_SIZE, false, false>;
+using MasterAddressField = Field<MASTER_ADDRESS_BIT_SIZE, true, false>;
+using SlaveAddressField  = Field<SLAVE_ADDRESS_BIT_SIZE, true, true>;
+using ControlField       = Field<CONTROL_BIT_SIZE, true, true>;
+using DataLengthField    = Field<DATA_LENGTH_BIT_SIZE, true, true>;
+using DataField          = Field<DATA_BIT_SIZE, true, true>;
+
+} // namespace iebus
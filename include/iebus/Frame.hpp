@@ -0,0 +1,100 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+auto constexpr BROADCAST_BIT_SIZE      = 1;
+auto constexpr MASTER_ADDRESS_BIT_SIZE = 12;
+auto constexpr SLAVE_ADDRESS_BIT_SIZE  = 12;
+auto constexpr CONTROL_BIT_SIZE        = 4;
+auto constexpr DATA_LENGTH_BIT_SIZE    = 8;
+auto constexpr DATA_BIT_SIZE           = 8;
+auto constexpr PARITY_BIT_SIZE         = 1;
+auto constexpr ACK_BIT_SIZE            = 1;
+
+/**
+ * Bits of the longest frame including start bit, parity bits and acknowledgment slots
+ */
+auto constexpr MAX_FRAME_BIT_SIZE = 1 + BROADCAST_BIT_SIZE + (MASTER_ADDRESS_BIT_SIZE + PARITY_BIT_SIZE) + (SLAVE_ADDRESS_BIT_SIZE + PARITY_BIT_SIZE + ACK_BIT_SIZE) +
+                                    (CONTROL_BIT_SIZE + PARITY_BIT_SIZE + ACK_BIT_SIZE) + (DATA_LENGTH_BIT_SIZE + PARITY_BIT_SIZE + ACK_BIT_SIZE) +
+                                    MAX_MESSAGE_SIZE * (DATA_BIT_SIZE + PARITY_BIT_SIZE + ACK_BIT_SIZE);
+
+enum class Symbol : std::uint8_t {
+  START_BIT = 0,
+  BIT_0     = 1,
+  BIT_1     = 2,
+  ACK_SLOT  = 3,
+};
+
+/**
+ * @class Frame
+ * Bit level image of an IEBus frame prepared for transmission
+ */
+class Frame {
+public:
+  using Symbols = std::span<Symbol const>;
+
+public:
+  /**
+   * Get frame symbols
+   * @return Symbols
+   */
+  [[nodiscard]] auto getSymbols() const -> Symbols;
+
+public:
+  /**
+   * Remove all symbols
+   */
+  auto clear() -> void;
+  /**
+   * Append start bit
+   */
+  auto appendStartBit() -> void;
+  /**
+   * Append single bit
+   * @param bit Data bit
+   */
+  auto appendBit(Bit bit) -> void;
+  /**
+   * Append data bits, most significant bit first
+   * @param data Data bits
+   * @param numBits Data size
+   */
+  auto appendBits(Data data, Size numBits) -> void;
+  /**
+   * Append acknowledgment slot driven by the receiver
+   */
+  auto appendAckSlot() -> void;
+
+private:
+  auto append(Symbol symbol) -> void;
+
+private:
+  std::array<Symbol, MAX_FRAME_BIT_SIZE> m_symbols = {};
+  Size m_size                                      = 0;
+};
+
+} // namespace iebus
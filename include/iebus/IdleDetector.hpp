@@ -0,0 +1,118 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class IdleDetector
+ * Bus free event driven by the RX line edges and a one-shot timer.
+ * Every falling edge arms the timer for one data bit period, every rising edge cancels it, so the waiting task sleeps until the bus is free.
+ * The waiting task is woken a few microseconds after the bus becomes free only with CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD.
+ * Without it the timer callback runs in the esp_timer task, which adds its scheduling latency, and another master may take the bus meanwhile
+ */
+class IdleDetector {
+public:
+  using Pin = std::uint8_t;
+
+public:
+  explicit IdleDetector(Pin rx) noexcept;
+  ~IdleDetector();
+
+public:
+  IdleDetector(IdleDetector const&)                    = delete;
+  auto operator=(IdleDetector const&) -> IdleDetector& = delete;
+
+public:
+  /**
+   * Check if idle timer is created
+   * @return bool
+   */
+  [[nodiscard]] auto isEnabled() const -> bool;
+  /**
+   * Check if the bus has been low for one data bit period since watching started
+   * @return bool
+   */
+  [[nodiscard]] auto isIdle() const -> bool;
+
+public:
+  /**
+   * Create idle timer
+   * @return bool
+   */
+  auto enable() -> bool;
+  /**
+   * Delete idle timer
+   */
+  auto disable() -> void;
+
+public:
+  /**
+   * Start watching the line. The bus counts as free one data bit period after now or after the next falling edge
+   */
+  auto start() -> void;
+  /**
+   * Stop watching the line
+   */
+  auto stop() -> void;
+  /**
+   * Report an RX line edge. Safe to call from the edge ISR
+   * @param level Line level after the edge
+   */
+  auto onEdge(Bit level) -> void;
+  /**
+   * Block with the notification of the calling task until the bus is free
+   * @param timeout Wait timeout in ticks
+   * @return False on timeout
+   */
+  [[nodiscard]] auto wait(TickType_t timeout) -> bool;
+
+private:
+  static auto onTimer(void* context) -> void;
+
+private:
+  /**
+   * Restart idle timer if the line is low, must be called in the critical section
+   * @param level Line level
+   */
+  auto arm(Bit level) -> void;
+
+private:
+  Pin const m_rxPin;
+
+private:
+  esp_timer_handle_t m_timer = nullptr;
+
+private:
+  std::atomic<bool> m_isWatching          = false;
+  std::atomic<bool> m_isIdle              = false;
+  std::atomic<TaskHandle_t> m_waitingTask = nullptr;
+  portMUX_TYPE m_lock                     = portMUX_INITIALIZER_UNLOCKED;
+};
+
+} // namespace iebus
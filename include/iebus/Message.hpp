@@ -20,6 +20,7 @@
 
 #include <array>
 #include <cstdint>
+#include <span>
 #include <string>
 
 namespace iebus {
@@ -31,6 +32,8 @@ using Byte    = std::uint8_t;
 using Size    = std::size_t;
 using Bytes   = std::array<Byte, MAX_MESSAGE_SIZE>;
 using Address = std::uint16_t;
+using Data    = std::uint16_t;
+using Time    = std::int64_t;
 
 enum class BroadcastType : Bit {
   BROADCAST  = 0,
@@ -45,6 +48,17 @@ struct Message {
   Size dataLength;
   Bytes data;
 
+  /**
+   * Get the first dataLength data bytes
+   * @return Data
+   */
+  [[nodiscard]] auto getData() const -> std::span<Byte const>;
+  /**
+   * Write null terminated text form without allocation, see MessageFormatter
+   * @param buffer Destination, MessageFormatter::MAX_SIZE + 1 chars for any message
+   * @return Number of written chars without terminating null
+   */
+  [[nodiscard]] auto format(std::span<char> buffer) const -> Size;
   [[nodiscard]] [[maybe_unused]] auto toString() const -> std::string;
 };
 
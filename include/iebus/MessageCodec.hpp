@@ -0,0 +1,199 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class MessageCodec
+ * Compact binary form of a message for network bridges and host tools. Multibyte values are little endian.
+ *
+ * Record: size (2 bytes, whole record), flags (1), control (1), master (2), slave (2), optional timestamp (8, microseconds), data bytes.
+ * The data size follows from the record size
+ */
+class MessageCodec {
+public:
+  enum Flag : std::uint8_t {
+    FLAG_BROADCAST = 1 << 0,
+    FLAG_TIMESTAMP = 1 << 1,
+  };
+
+  /**
+   * Message fields with a borrowed payload
+   */
+  struct Record {
+    BroadcastType broadcast;
+    Address master;
+    Address slave;
+    Byte control;
+    std::span<Byte const> data;
+    std::optional<Time> timestamp = std::nullopt;
+  };
+
+public:
+  static auto constexpr HEADER_SIZE     = 8;
+  static auto constexpr TIMESTAMP_SIZE  = 8;
+  static auto constexpr MAX_RECORD_SIZE = HEADER_SIZE + TIMESTAMP_SIZE + MAX_MESSAGE_SIZE;
+
+public:
+  /**
+   * Encoded header followed by the borrowed payload, for scatter/gather output without a copy
+   */
+  struct Parts {
+    std::array<Byte, HEADER_SIZE + TIMESTAMP_SIZE> headerBuffer;
+    Size headerSize;
+    std::span<Byte const> data;
+
+    [[nodiscard]] auto getHeader() const -> std::span<Byte const> {
+      return std::span(headerBuffer).first(headerSize);
+    }
+  };
+
+public:
+  /**
+   * Make record view of the first dataLength bytes of the message
+   * @param message Message, must outlive the record
+   * @param timestamp Optional receive time
+   * @return Record
+   */
+  [[nodiscard]] static auto makeRecord(Message const& message, std::optional<Time> timestamp = std::nullopt) -> Record;
+  /**
+   * Get encoded record size
+   * @param record Record
+   * @return Size
+   */
+  [[nodiscard]] static auto getSize(Record const& record) -> Size;
+  /**
+   * Encode the record header, the payload is referenced
+   * @param record Record with at most MAX_MESSAGE_SIZE data bytes
+   * @return Parts
+   */
+  [[nodiscard]] static auto encode(Record const& record) -> Parts;
+  /**
+   * Encode the record into the buffer
+   * @param record Record with at most MAX_MESSAGE_SIZE data bytes
+   * @param buffer Destination
+   * @return Number of written bytes, zero if the buffer is too small
+   */
+  [[nodiscard]] static auto encode(Record const& record, std::span<Byte> buffer) -> Size;
+  /**
+   * Decode a record at the start of the buffer, the payload points into the buffer
+   * @param buffer Encoded records
+   * @return Record or nullopt if the buffer does not start with a valid record
+   */
+  [[nodiscard]] static auto decode(std::span<Byte const> buffer) -> std::optional<Record>;
+  /**
+   * Copy the record into a full message
+   * @param record Record
+   * @param message Message to fill
+   */
+  static auto toMessage(Record const& record, Message& message) -> void;
+};
+
+/**
+ * @class MessageBatchWriter
+ * Packs records back to back behind a batch header, e.g. to fill one network packet.
+ * Batch header: magic 'I' (1 byte), version (1), record count (2)
+ */
+class MessageBatchWriter {
+public:
+  static auto constexpr MAGIC       = 'I';
+  static auto constexpr VERSION     = 1;
+  static auto constexpr HEADER_SIZE = 4;
+
+public:
+  /**
+   * @param buffer Batch storage, at least HEADER_SIZE bytes
+   */
+  explicit MessageBatchWriter(std::span<Byte> buffer) noexcept;
+
+public:
+  /**
+   * Get number of packed records
+   * @return Count
+   */
+  [[nodiscard]] auto getCount() const -> Size;
+  /**
+   * Get encoded batch
+   * @return Header and records
+   */
+  [[nodiscard]] auto getData() const -> std::span<Byte const>;
+
+public:
+  /**
+   * Append a record
+   * @param record Record
+   * @return False if it does not fit into the rest of the buffer
+   */
+  auto append(MessageCodec::Record const& record) -> bool;
+  /**
+   * Drop packed records
+   */
+  auto reset() -> void;
+
+private:
+  std::span<Byte> m_buffer;
+  Size m_size  = 0;
+  Size m_count = 0;
+};
+
+/**
+ * @class MessageBatchReader
+ * Iterates records of a batch without copying
+ */
+class MessageBatchReader {
+public:
+  /**
+   * @param buffer Batch made by MessageBatchWriter
+   */
+  explicit MessageBatchReader(std::span<Byte const> buffer) noexcept;
+
+public:
+  /**
+   * Check if the batch header is valid
+   * @return bool
+   */
+  [[nodiscard]] auto isValid() const -> bool;
+  /**
+   * Get number of records announced by the batch header
+   * @return Count
+   */
+  [[nodiscard]] auto getCount() const -> Size;
+
+public:
+  /**
+   * Take the next record, its payload points into the batch
+   * @return Record or nullopt at the end of the batch or on a malformed record
+   */
+  [[nodiscard]] auto next() -> std::optional<MessageCodec::Record>;
+
+private:
+  std::span<Byte const> m_buffer;
+  Size m_offset = 0;
+  Size m_count  = 0;
+  Size m_index  = 0;
+};
+
+} // namespace iebus
@@ -0,0 +1,158 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#pragma once
+
+#include <span>
+
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class MessageFormatter
+ * Allocation free text form of a message, e.g. "D M0x0123 S0x0456 C0x0f L2 [0A FF]".
+ * Only the given data bytes are formatted, digits are taken from lookup tables
+ */
+class MessageFormatter {
+public:
+  /**
+   * Get exact text size without terminating null
+   * @param dataSize Number of data bytes
+   * @return Size
+   */
+  [[nodiscard]] static constexpr auto getSize(Size const dataSize) -> Size {
+    auto const lengthDigits = dataSize >= 100 ? 3 : dataSize >= 10 ? 2 : 1;
+    auto const dataChars    = dataSize > 0 ? dataSize * 3 - 1 : 0;
+
+    return FIXED_SIZE + lengthDigits + dataChars;
+  }
+
+public:
+  /**
+   * Write text to the output iterator
+   * @tparam OutputIt Output iterator of char
+   * @param out Destination
+   * @param broadcast Broadcast type
+   * @param master Master address
+   * @param slave Slave address
+   * @param control Control field
+   * @param data Data bytes
+   * @return Iterator past the last written char
+   */
+  template <typename OutputIt>
+  static auto format(OutputIt out, BroadcastType broadcast, Address master, Address slave, Byte control, std::span<Byte const> data) -> OutputIt;
+  /**
+   * Write null terminated text into the buffer, truncating it like snprintf
+   * @param buffer Destination, getSize() + 1 chars for the whole text
+   * @param broadcast Broadcast type
+   * @param master Master address
+   * @param slave Slave address
+   * @param control Control field
+   * @param data Data bytes
+   * @return Number of written chars without terminating null
+   */
+  static auto format(std::span<char> buffer, BroadcastType broadcast, Address master, Address slave, Byte control, std::span<Byte const> data) -> Size;
+
+public:
+  /**
+   * "B M0x S0x C0x L []"
+   */
+  static auto constexpr FIXED_SIZE = 28;
+  /**
+   * Text size of MAX_MESSAGE_SIZE data bytes
+   */
+  static auto constexpr MAX_SIZE = FIXED_SIZE + 3 + MAX_MESSAGE_SIZE * 3 - 1;
+
+private:
+  static constexpr char LOWER_DIGITS[] = "0123456789abcdef";
+  static constexpr char UPPER_DIGITS[] = "0123456789ABCDEF";
+
+private:
+  template <typename OutputIt> static auto writeHex(OutputIt out, Data value, Size digits, char const* table) -> OutputIt;
+};
+
+template <typename OutputIt> auto MessageFormatter::writeHex(OutputIt out, Data const value, Size const digits, char const* const table) -> OutputIt {
+  for (Size i = digits; i > 0; --i) {
+    *out++ = table[(value >> ((i - 1) * 4)) & 0xF];
+  }
+
+  return out;
+}
+
+template <typename OutputIt>
+auto MessageFormatter::format(OutputIt out, BroadcastType const broadcast, Address const master, Address const slave, Byte const control, std::span<Byte const> const data)
+    -> OutputIt {
+  switch (broadcast) {
+  case BroadcastType::BROADCAST:
+    *out++ = 'B';
+    break;
+  case BroadcastType::FOR_DEVICE:
+    *out++ = 'D';
+    break;
+  default:
+    *out++ = 'U';
+    break;
+  }
+
+  *out++ = ' ';
+  *out++ = 'M';
+  *out++ = '0';
+  *out++ = 'x';
+  out    = writeHex(out, master, 4, LOWER_DIGITS);
+
+  *out++ = ' ';
+  *out++ = 'S';
+  *out++ = '0';
+  *out++ = 'x';
+  out    = writeHex(out, slave, 4, LOWER_DIGITS);
+
+  *out++ = ' ';
+  *out++ = 'C';
+  *out++ = '0';
+  *out++ = 'x';
+  out    = writeHex(out, control, 2, LOWER_DIGITS);
+
+  *out++ = ' ';
+  *out++ = 'L';
+
+  auto const size = data.size();
+  if (size >= 100) {
+    *out++ = LOWER_DIGITS[size / 100 % 10];
+  }
+  if (size >= 10) {
+    *out++ = LOWER_DIGITS[size / 10 % 10];
+  }
+  *out++ = LOWER_DIGITS[size % 10];
+
+  *out++ = ' ';
+  *out++ = '[';
+
+  for (Size i = 0; i < size; ++i) {
+    if (i > 0) {
+      *out++ = ' ';
+    }
+
+    out = writeHex(out, data[i], 2, UPPER_DIGITS);
+  }
+
+  *out++ = ']';
+
+  return out;
+}
+
+} // namespace iebus
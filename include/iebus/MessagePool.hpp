@@ -0,0 +1,134 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class MessagePool
+ * Preallocated pool of message buffers.
+ * Buffers are handed out as unique handles and return to the pool when the handle is destroyed,
+ * so received frames travel from the decoder to consumers without copies or heap use
+ */
+class MessagePool {
+public:
+  /**
+   * @class Handle
+   * Unique owner of a pooled message
+   */
+  class Handle {
+  public:
+    Handle() noexcept = default;
+    ~Handle();
+
+  public:
+    Handle(Handle&& other) noexcept;
+    auto operator=(Handle&& other) noexcept -> Handle&;
+
+  public:
+    Handle(Handle const&)                    = delete;
+    auto operator=(Handle const&) -> Handle& = delete;
+
+  public:
+    [[nodiscard]] explicit operator bool() const;
+    [[nodiscard]] auto operator*() const -> Message&;
+    [[nodiscard]] auto operator->() const -> Message*;
+
+  public:
+    /**
+     * Get owned message
+     * @return Message or nullptr
+     */
+    [[nodiscard]] auto get() const -> Message*;
+    /**
+     * Give up ownership without returning the message to the pool
+     * @return Message or nullptr
+     */
+    [[nodiscard]] auto detach() -> Message*;
+    /**
+     * Return the message to the pool
+     */
+    auto reset() -> void;
+
+  private:
+    friend class MessagePool;
+
+  private:
+    Handle(MessagePool* pool, Message* message) noexcept;
+
+  private:
+    MessagePool* m_pool = nullptr;
+    Message* m_message  = nullptr;
+  };
+
+public:
+  MessagePool() noexcept = default;
+  ~MessagePool();
+
+public:
+  MessagePool(MessagePool const&)                    = delete;
+  auto operator=(MessagePool const&) -> MessagePool& = delete;
+
+public:
+  /**
+   * Get number of messages in the pool
+   * @return Size
+   */
+  [[nodiscard]] auto getCapacity() const -> Size;
+  /**
+   * Get number of messages not owned by any handle
+   * @return Size
+   */
+  [[nodiscard]] auto getAvailable() const -> Size;
+
+public:
+  /**
+   * Allocate message buffers. An existing pool is kept if it has the same capacity
+   * @param capacity Number of messages
+   * @return False on allocation failure or if messages of the existing pool are still in use
+   */
+  auto create(Size capacity) -> bool;
+  /**
+   * Take a free message
+   * @return Handle, empty if the pool is exhausted
+   */
+  [[nodiscard]] auto acquire() -> Handle;
+  /**
+   * Take back ownership of a detached message
+   * @param message Message obtained with Handle::detach()
+   * @return Handle
+   */
+  [[nodiscard]] auto attach(Message* message) -> Handle;
+
+private:
+  auto release(Message* message) -> void;
+  auto destroy() -> void;
+
+private:
+  Message* m_messages  = nullptr;
+  Size m_capacity      = 0;
+  QueueHandle_t m_free = nullptr;
+};
+
+} // namespace iebus
@@ -0,0 +1,85 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <atomic>
+
+#include <esp_pm.h>
+
+namespace iebus {
+
+/**
+ * @class PowerLock
+ * Power management locks held while the bus is active: maximum CPU frequency for the cycle timed bit loops and no light sleep.
+ * Without CONFIG_PM_ENABLE the locks can not be created and the chip never sleeps anyway
+ */
+class PowerLock {
+public:
+  PowerLock() noexcept = default;
+  ~PowerLock();
+
+public:
+  PowerLock(PowerLock const&)                    = delete;
+  auto operator=(PowerLock const&) -> PowerLock& = delete;
+
+public:
+  /**
+   * Check if locks are created
+   * @return bool
+   */
+  [[nodiscard]] auto isCreated() const -> bool;
+  /**
+   * Check if locks are held
+   * @return bool
+   */
+  [[nodiscard]] auto isAcquired() const -> bool;
+
+public:
+  /**
+   * Create locks
+   * @return bool
+   */
+  auto create() -> bool;
+  /**
+   * Release and delete locks
+   */
+  auto destroy() -> void;
+
+public:
+  /**
+   * Hold locks and recalibrate the cycle timebase to the raised CPU frequency
+   */
+  auto acquire() -> void;
+  /**
+   * Hold locks from an interrupt, e.g. the one waking the chip, so the CPU frequency is raised before the woken task runs.
+   * The task calls acquire() afterwards to recalibrate the timebase
+   */
+  auto acquireFromISR() -> void;
+  /**
+   * Release locks, allowing frequency scaling and light sleep
+   */
+  auto release() -> void;
+
+private:
+  esp_pm_lock_handle_t m_frequencyLock = nullptr;
+  esp_pm_lock_handle_t m_sleepLock     = nullptr;
+  std::atomic<bool> m_isAcquired       = false;
+};
+
+} // namespace iebus
@@ -0,0 +1,143 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <span>
+
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class RingBuffer
+ * Lock-free single producer / single consumer ring buffer.
+ * Producer may run in an ISR, consumer in a task
+ * @tparam T Item type
+ * @tparam Capacity Number of items, power of two
+ */
+template <typename T, Size Capacity> class RingBuffer {
+  static_assert(Capacity > 0 and (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  /**
+   * Check if buffer has no items
+   * @return bool
+   */
+  [[nodiscard]] auto isEmpty() const -> bool {
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+  }
+  /**
+   * Get number of stored items
+   * @return Size
+   */
+  [[nodiscard]] auto getSize() const -> Size {
+    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+  }
+
+public:
+  /**
+   * Store item. Called by the producer only
+   * @param item Item
+   * @return False if buffer is full
+   */
+  auto push(T const& item) -> bool {
+    auto const tail = m_tail.load(std::memory_order_relaxed);
+    auto const head = m_head.load(std::memory_order_acquire);
+
+    if (tail - head >= Capacity) {
+      return false;
+    }
+
+    m_items[tail & MASK] = item;
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+  }
+  /**
+   * Store all items or none. Called by the producer only
+   * @param items Items
+   * @return False if there is not enough free space
+   */
+  auto push(std::span<T const> items) -> bool {
+    auto const tail = m_tail.load(std::memory_order_relaxed);
+    auto const head = m_head.load(std::memory_order_acquire);
+
+    if (Capacity - (tail - head) < items.size()) {
+      return false;
+    }
+
+    for (Size i = 0; i < items.size(); ++i) {
+      m_items[(tail + i) & MASK] = items[i];
+    }
+
+    m_tail.store(tail + items.size(), std::memory_order_release);
+
+    return true;
+  }
+  /**
+   * Take the oldest item. Called by the consumer only
+   * @return Optional item
+   */
+  auto pop() -> std::optional<T> {
+    auto const head = m_head.load(std::memory_order_relaxed);
+    auto const tail = m_tail.load(std::memory_order_acquire);
+
+    if (head == tail) {
+      return std::nullopt;
+    }
+
+    auto const item = m_items[head & MASK];
+    m_head.store(head + 1, std::memory_order_release);
+
+    return item;
+  }
+  /**
+   * Take a batch of the oldest items. Called by the consumer only
+   * @param items Destination
+   * @return Number of taken items
+   */
+  auto pop(std::span<T> items) -> Size {
+    auto const head = m_head.load(std::memory_order_relaxed);
+    auto const tail = m_tail.load(std::memory_order_acquire);
+
+    auto const available = tail - head;
+    auto const count     = available < items.size() ? available : items.size();
+
+    for (Size i = 0; i < count; ++i) {
+      items[i] = m_items[(head + i) & MASK];
+    }
+
+    m_head.store(head + count, std::memory_order_release);
+
+    return count;
+  }
+
+private:
+  static auto constexpr MASK = Capacity - 1;
+
+private:
+  std::array<T, Capacity> m_items = {};
+  std::atomic<Size> m_head        = 0;
+  std::atomic<Size> m_tail        = 0;
+};
+
+} // namespace iebus
@@ -0,0 +1,140 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include <driver/rmt_types.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class RmtReceiver
+ * Hardware edge capture of the IEBus RX line based on the RMT peripheral.
+ * Every captured pulse train is a sequence of RMT symbols where the first half
+ * of a symbol is the high (dominant) period of a bit and the second half is the low one.
+ * On chips without RMT RX ping-pong support long frames are truncated to the channel memory.
+ * With CONFIG_RMT_RECV_FUNC_IN_IRAM the next capture is started from the receive done interrupt,
+ * otherwise from the task once it is woken, so a frame following within the task wakeup latency may be missed.
+ */
+class RmtReceiver {
+public:
+  using Pin     = std::uint8_t;
+  using Symbols = std::span<rmt_symbol_word_t const>;
+
+  /**
+   * Pulse train captured between two idle periods of the bus
+   */
+  struct Capture {
+    Symbols symbols;
+    Time timestamp;
+  };
+
+public:
+  explicit RmtReceiver(Pin rx) noexcept;
+  ~RmtReceiver();
+
+public:
+  RmtReceiver(RmtReceiver const&)                    = delete;
+  auto operator=(RmtReceiver const&) -> RmtReceiver& = delete;
+
+public:
+  /**
+   * Check if RMT channel is running
+   * @return bool
+   */
+  [[nodiscard]] auto isEnabled() const -> bool;
+
+public:
+  /**
+   * Allocate capture buffers and start the RMT channel
+   * @return bool
+   */
+  auto enable() -> bool;
+  /**
+   * Stop the RMT channel and free capture buffers
+   */
+  auto disable() -> void;
+
+public:
+  /**
+   * Wait for the next captured pulse train.
+   * The capture returned by a previous call is released and must not be used anymore.
+   * @param timeout Wait timeout in ticks
+   * @return Optional capture
+   */
+  [[nodiscard]] auto receive(TickType_t timeout) -> std::optional<Capture>;
+  /**
+   * Let the next finished capture give the task notification once, for a task waiting on several receivers
+   * @param task Task to wake
+   * @return False if a capture is already pending and the task must not wait
+   */
+  [[nodiscard]] auto armWakeup(TaskHandle_t task) -> bool;
+
+private:
+  struct Event {
+    Size buffer;
+    Size size;
+    Time timestamp;
+  };
+
+private:
+  static auto onReceiveDone(rmt_channel_handle_t channel, rmt_rx_done_event_data_t const* data, void* context) -> bool;
+
+private:
+  auto startReceive(Size buffer) -> bool;
+  /**
+   * Start capture into a free buffer if it is stalled
+   */
+  auto resumeReceive() -> void;
+  /**
+   * Start capture into the taken buffer. On failure the buffer is freed and the capture is left stalled for the next retry
+   * @param buffer Buffer index
+   */
+  auto restartReceive(Size buffer) -> void;
+  auto releaseBuffer(Size buffer) -> void;
+
+private:
+  Pin const m_rxPin;
+
+private:
+  rmt_channel_handle_t m_channel = nullptr;
+  rmt_symbol_word_t* m_buffers   = nullptr;
+  QueueHandle_t m_events         = nullptr;
+
+private:
+  portMUX_TYPE m_lock              = portMUX_INITIALIZER_UNLOCKED;
+  std::uint32_t m_freeBuffers      = 0;
+  Size m_activeBuffer              = 0;
+  std::optional<Size> m_heldBuffer = std::nullopt;
+  bool m_isReceiveStalled          = false;
+
+private:
+  std::atomic<TaskHandle_t> m_wakeupTask = nullptr;
+};
+
+} // namespace iebus
@@ -0,0 +1,100 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <driver/rmt_types.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <iebus/Frame.hpp>
+
+namespace iebus {
+
+/**
+ * @class RmtTransmitter
+ * Hardware timed output of frame symbols on the IEBus TX line based on the RMT peripheral
+ */
+class RmtTransmitter {
+public:
+  using Pin = std::uint8_t;
+
+public:
+  explicit RmtTransmitter(Pin tx) noexcept;
+  ~RmtTransmitter();
+
+public:
+  RmtTransmitter(RmtTransmitter const&)                    = delete;
+  auto operator=(RmtTransmitter const&) -> RmtTransmitter& = delete;
+
+public:
+  /**
+   * Check if RMT channel is running
+   * @return bool
+   */
+  [[nodiscard]] auto isEnabled() const -> bool;
+
+public:
+  /**
+   * Set high times of the data bit waveforms, the bit period is kept. Must not be called during a transmission
+   * @param bit0HighUS Bit 0 high time
+   * @param bit1HighUS Bit 1 high time
+   */
+  auto setBitTiming(std::uint32_t bit0HighUS, std::uint32_t bit1HighUS) -> void;
+
+public:
+  /**
+   * Create and start the RMT channel
+   * @return bool
+   */
+  auto enable() -> bool;
+  /**
+   * Stop and delete the RMT channel
+   */
+  auto disable() -> void;
+
+public:
+  /**
+   * Clock symbols out and block until the transmission is completed
+   * @param symbols Frame symbols
+   * @return bool
+   */
+  [[nodiscard]] auto transmit(Frame::Symbols symbols) -> bool;
+
+private:
+  static auto onTransmitDone(rmt_channel_handle_t channel, rmt_tx_done_event_data_t const* data, void* context) -> bool;
+
+private:
+  Pin const m_txPin;
+
+private:
+  /**
+   * Waveforms indexed by Symbol. Acknowledgment slot is sent as bit 1 so a receiver can stretch it to bit 0
+   */
+  std::array<rmt_symbol_word_t, 4> m_waveforms = {};
+
+private:
+  rmt_channel_handle_t m_channel = nullptr;
+  rmt_encoder_handle_t m_encoder = nullptr;
+  SemaphoreHandle_t m_done       = nullptr;
+};
+
+} // namespace iebus
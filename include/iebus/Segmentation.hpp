@@ -0,0 +1,132 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <bitset>
+#include <optional>
+#include <span>
+
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * Segment frame data starts with the segment index and the index of the last segment
+ */
+auto constexpr SEGMENT_HEADER_SIZE  = 2;
+auto constexpr SEGMENT_PAYLOAD_SIZE = MAX_MESSAGE_SIZE - SEGMENT_HEADER_SIZE;
+auto constexpr MAX_SEGMENT_COUNT    = 256;
+auto constexpr MAX_SEGMENTED_SIZE   = MAX_SEGMENT_COUNT * SEGMENT_PAYLOAD_SIZE;
+
+/**
+ * Get number of segments needed for the payload
+ * @param size Payload size
+ * @return Segment count
+ */
+[[nodiscard]] constexpr auto getSegmentCount(Size const size) -> Size {
+  return size == 0 ? 1 : (size + SEGMENT_PAYLOAD_SIZE - 1) / SEGMENT_PAYLOAD_SIZE;
+}
+
+/**
+ * @class Reassembler
+ * Collects segments of one transfer straight into a caller provided buffer.
+ * Segments may arrive in any order and repeated segments are ignored
+ */
+class Reassembler {
+public:
+  enum class Status {
+    /**
+     * Message is not a valid segment
+     */
+    INVALID,
+    /**
+     * Segment is stored, more segments are expected
+     */
+    IN_PROGRESS,
+    /**
+     * All segments are stored
+     */
+    COMPLETE,
+    /**
+     * Transfer does not fit into the buffer
+     */
+    BUFFER_OVERFLOW,
+  };
+
+public:
+  explicit Reassembler(std::span<Byte> buffer) noexcept;
+
+public:
+  /**
+   * Check if all segments are stored
+   * @return bool
+   */
+  [[nodiscard]] auto isComplete() const -> bool;
+  /**
+   * Get reassembled payload
+   * @return Payload, empty until the transfer is complete
+   */
+  [[nodiscard]] auto getData() const -> std::span<Byte const>;
+  /**
+   * Get destination of the segment started by prepare()
+   * @return Payload location in the buffer, empty if no segment is started
+   */
+  [[nodiscard]] auto getSegmentBuffer() const -> std::span<Byte>;
+
+public:
+  /**
+   * Store segment. A segment with another master or segment count starts a new transfer
+   * @param message Received segment frame
+   * @return Status
+   */
+  auto accept(Message const& message) -> Status;
+  /**
+   * Start a segment whose payload is then written straight into getSegmentBuffer(), e.g. while it is still on the bus.
+   * A repeated segment is received again in place
+   * @param master Sender address
+   * @param header Segment header bytes
+   * @param payloadSize Payload size without the header
+   * @return IN_PROGRESS if the segment is started
+   */
+  auto prepare(Address master, std::span<Byte const, SEGMENT_HEADER_SIZE> header, Size payloadSize) -> Status;
+  /**
+   * Mark the started segment as stored once its payload is written
+   * @return Status
+   */
+  auto commit() -> Status;
+  /**
+   * Drop stored segments
+   */
+  auto reset() -> void;
+
+private:
+  std::span<Byte> const m_buffer;
+
+private:
+  std::bitset<MAX_SEGMENT_COUNT> m_receivedSegments;
+  Size m_segmentCount = 0;
+  Size m_size         = 0;
+  Address m_master    = 0;
+
+private:
+  std::optional<Size> m_pendingIndex = std::nullopt;
+  Size m_pendingSize                 = 0;
+};
+
+} // namespace iebus
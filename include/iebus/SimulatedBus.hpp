@@ -0,0 +1,126 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#pragma once
+
+#include <array>
+#include <optional>
+#include <span>
+
+#include <iebus/Backend.hpp>
+#include <iebus/Frame.hpp>
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class SimulatedBus
+ * Backend replaying a recorded pulse trace. Own transmissions are looped back as an echo before the rest of the trace,
+ * with acknowledgment slots answered by a simulated slave. Nothing waits, receive() returns nullopt once the trace is over
+ */
+class SimulatedBus : public Backend {
+public:
+  SimulatedBus() noexcept = default;
+
+public:
+  SimulatedBus(SimulatedBus const&)                    = delete;
+  auto operator=(SimulatedBus const&) -> SimulatedBus& = delete;
+
+public:
+  /**
+   * Build a pulse trace of a frame
+   * @param symbols Frame symbols
+   * @param startTime Start bit timestamp
+   * @param isAcknowledged Acknowledgment slots are sent as ACK, otherwise as NAK
+   * @param trace Destination, one pulse per symbol
+   * @return Number of written pulses
+   */
+  static auto makeTrace(Frame::Symbols symbols, Time startTime, bool isAcknowledged, std::span<Pulse> trace) -> Size;
+
+public:
+  /**
+   * Get earliest start time of a transmission, the end of the last replayed pulse followed by an idle bus
+   * @return Microseconds
+   */
+  [[nodiscard]] auto getTime() const -> Time override;
+  [[nodiscard]] auto isBusFree() const -> bool override;
+  /**
+   * Check if the trace and the echo are replayed
+   * @return bool
+   */
+  [[nodiscard]] auto isFinished() const -> bool;
+
+public:
+  /**
+   * Set trace to replay, it is not copied and has to stay valid while it is replayed
+   * @param trace Pulses ordered by timestamp
+   */
+  auto load(std::span<Pulse const> trace) -> void;
+  /**
+   * Set answer of the simulated slave to the own transmissions
+   * @param isAcknowledged ACK if true, NAK otherwise
+   */
+  auto setAcknowledgment(bool isAcknowledged) -> void;
+  /**
+   * Answer a single own transmission with NAK regardless of setAcknowledgment()
+   * @param index Number of own transmissions before it, zero for the next one
+   */
+  auto failTransmission(Size index) -> void;
+
+public:
+  auto enable() -> bool override;
+  auto disable() -> void override;
+
+public:
+  [[nodiscard]] auto receive(Time timeoutUS) -> std::optional<Pulse> override;
+  /**
+   * Loop symbols back as an echo starting at the current bus time, replacing the echo not received yet
+   * @param symbols Frame symbols, copied
+   * @return False if the bus is disabled
+   */
+  [[nodiscard]] auto transmit(Frame::Symbols symbols) -> bool override;
+
+private:
+  static auto makePulse(Symbol symbol, Time timestamp, bool isAcknowledged) -> Pulse;
+  static auto getSymbolTime(Symbol symbol) -> Time;
+
+private:
+  auto advance(Pulse const& pulse) -> void;
+
+private:
+  bool m_isEnabled      = false;
+  bool m_isAcknowledged = true;
+  Time m_time           = 0;
+
+private:
+  std::optional<Size> m_failedTransmission = std::nullopt;
+  Size m_transmissionCount                 = 0;
+
+private:
+  std::span<Pulse const> m_trace = {};
+  Size m_traceIndex              = 0;
+  Time m_traceOffset             = 0;
+
+private:
+  std::array<Symbol, MAX_FRAME_BIT_SIZE> m_echo = {};
+  Size m_echoSize                              = 0;
+  Size m_echoIndex                             = 0;
+  Time m_echoTime                              = 0;
+  bool m_isEchoAcknowledged                    = true;
+};
+
+} // namespace iebus
@@ -0,0 +1,153 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <span>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <iebus/Message.hpp>
+#include <iebus/RingBuffer.hpp>
+
+namespace iebus {
+
+/**
+ * @class Sniffer
+ * Stream of binary capture records of every frame seen on the bus.
+ *
+ * Each record is a RecordHeader followed by the received data bytes, then the acknowledgment bitmap and the parity error bitmap.
+ * Bitmaps hold one bit per received field in bus order: broadcast, master address, slave address, control, data length, data bytes,
+ * least significant bit first, (fieldCount + 7) / 8 bytes each. Multibyte values are little endian.
+ * The producer is the receiver task, a single consumer streams the bytes out, records may be split across reads
+ */
+class Sniffer {
+public:
+  enum RecordFlag : std::uint8_t {
+    /**
+     * Frame is a broadcast, the broadcast field is zero
+     */
+    FLAG_BROADCAST = 1 << 0,
+    /**
+     * All fields announced by the data length are received
+     */
+    FLAG_COMPLETE = 1 << 1,
+    /**
+     * Frame is transmitted by this controller
+     */
+    FLAG_TRANSMITTED = 1 << 2,
+  };
+
+  struct RecordHeader {
+    /**
+     * Record size in bytes including the header
+     */
+    std::uint16_t size;
+    /**
+     * Number of received fields, zero if the frame ended right after the start bit
+     */
+    std::uint16_t fieldCount;
+    /**
+     * Start bit time in microseconds, wraps around
+     */
+    std::uint32_t timestamp;
+    std::uint16_t master;
+    std::uint16_t slave;
+    std::uint8_t control;
+    /**
+     * Data length field as sent, zero stands for MAX_MESSAGE_SIZE
+     */
+    std::uint8_t dataLength;
+    std::uint8_t flags;
+    std::uint8_t reserved;
+  };
+
+public:
+  static auto constexpr HEADER_FIELD_COUNT = 5;
+  static auto constexpr MAX_FIELD_COUNT    = HEADER_FIELD_COUNT + MAX_MESSAGE_SIZE;
+  static auto constexpr MAX_RECORD_SIZE    = sizeof(RecordHeader) + MAX_MESSAGE_SIZE + (MAX_FIELD_COUNT + 7) / 8 * 2;
+  static auto constexpr CAPACITY           = 4096;
+
+public:
+  Sniffer() noexcept = default;
+
+public:
+  Sniffer(Sniffer const&)                    = delete;
+  auto operator=(Sniffer const&) -> Sniffer& = delete;
+
+public:
+  /**
+   * Get number of buffered bytes
+   * @return Size
+   */
+  [[nodiscard]] auto getSize() const -> Size;
+  /**
+   * Get number of records dropped because the buffer was full
+   * @return Count
+   */
+  [[nodiscard]] auto getLostCount() const -> std::uint32_t;
+
+public:
+  /**
+   * Take buffered record bytes, blocking with the notification of the calling task while the buffer is empty
+   * @param buffer Destination
+   * @param timeout Wait timeout in ticks
+   * @return Number of taken bytes
+   */
+  [[nodiscard]] auto read(std::span<Byte> buffer, TickType_t timeout = 0) -> Size;
+
+public:
+  /**
+   * Start a record. Called by the producer only
+   * @param timestamp Start bit time
+   * @param isTransmitted Frame is sent by this controller
+   */
+  auto beginRecord(Time timestamp, bool isTransmitted = false) -> void;
+  /**
+   * Add the next field of the current record in bus order. Called by the producer only
+   * @param value Field value
+   * @param isParityValid Parity check result, true for fields without parity
+   * @param isAcknowledged Acknowledgment slot is ACK, false for fields without acknowledgment slot
+   */
+  auto addField(Data value, bool isParityValid, bool isAcknowledged) -> void;
+  /**
+   * Finish the current record and store it. Called by the producer only
+   * @return False if the record is dropped because the buffer is full
+   */
+  auto commitRecord() -> bool;
+
+private:
+  static auto constexpr BITMAP_SIZE = (MAX_FIELD_COUNT + 7) / 8;
+
+private:
+  RecordHeader m_header                                = {};
+  std::array<Byte, MAX_MESSAGE_SIZE> m_data            = {};
+  std::array<Byte, BITMAP_SIZE> m_acknowledgmentBitmap = {};
+  std::array<Byte, BITMAP_SIZE> m_parityErrorBitmap    = {};
+  std::array<Byte, MAX_RECORD_SIZE> m_record           = {};
+
+private:
+  RingBuffer<Byte, CAPACITY> m_buffer;
+  std::atomic<TaskHandle_t> m_waitingTask = nullptr;
+  std::atomic<std::uint32_t> m_lostCount  = 0;
+};
+
+} // namespace iebus
@@ -0,0 +1,156 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include <iebus/Diagnostics.hpp>
+#include <iebus/Message.hpp>
+
+namespace iebus {
+
+/**
+ * @class Statistics
+ * Runtime bus counters and timing histograms.
+ * Updates are relaxed atomics without logging, cheap enough to stay enabled in production
+ */
+class Statistics {
+public:
+  static auto constexpr FIELD_COUNT = 7;
+
+  /**
+   * Width of a bit high time histogram bin in microseconds, the last bin collects longer pulses
+   */
+  static auto constexpr HIGH_TIME_BIN_US    = 2;
+  static auto constexpr HIGH_TIME_BIN_COUNT = 32;
+
+  /**
+   * Latency bin N collects latencies below 2^N microseconds and not below 2^(N-1), the last bin collects longer ones
+   */
+  static auto constexpr LATENCY_BIN_COUNT = 20;
+
+public:
+  /**
+   * Plain copy of all values for export. Minimums are 0 when nothing was recorded
+   */
+  struct Snapshot {
+    std::uint32_t framesReceived;
+    std::uint32_t framesSent;
+    std::array<std::uint32_t, FIELD_COUNT> parityErrors;
+    std::uint32_t nakCount;
+    std::uint32_t arbitrationLostCount;
+    std::uint32_t startBitRejectCount;
+    std::uint32_t wakeupMissCount;
+    std::uint32_t queueOverflowCount;
+    std::uint32_t forwardDropCount;
+
+    std::uint32_t highTimeMinUS;
+    std::uint32_t highTimeMaxUS;
+    std::array<std::uint32_t, HIGH_TIME_BIN_COUNT> highTimeHistogram;
+
+    std::uint32_t latencyMinUS;
+    std::uint32_t latencyMaxUS;
+    std::array<std::uint32_t, LATENCY_BIN_COUNT> latencyHistogram;
+  };
+
+public:
+  Statistics() noexcept;
+
+public:
+  Statistics(Statistics const&)                    = delete;
+  auto operator=(Statistics const&) -> Statistics& = delete;
+
+public:
+  /**
+   * Copy current values. Counters are read one by one, so a snapshot taken during decoding may be off by the frame in progress
+   * @return Snapshot
+   */
+  [[nodiscard]] auto getSnapshot() const -> Snapshot;
+
+public:
+  auto countFrameReceived() -> void;
+  auto countFrameSent() -> void;
+  /**
+   * @param field Frame field with the parity error
+   */
+  auto countParityError(FrameField field) -> void;
+  auto countNak() -> void;
+  auto countArbitrationLost() -> void;
+  auto countStartBitReject() -> void;
+  /**
+   * Count frame lost because its start bit ended before the chip woke from light sleep
+   */
+  auto countWakeupMiss() -> void;
+  auto countQueueOverflow() -> void;
+  /**
+   * Count received message not bridged because the forwarding target is stopped or its scheduler is full
+   */
+  auto countForwardDrop() -> void;
+
+public:
+  /**
+   * Record measured bit high time. Must be called from the decoding task only
+   * @param highTime High time in microseconds
+   */
+  auto recordHighTime(Time highTime) -> void;
+  /**
+   * Record time from the start bit to delivery of the frame. Must be called from the delivering task only
+   * @param latency Latency in microseconds
+   */
+  auto recordLatency(Time latency) -> void;
+  /**
+   * Reset all values
+   */
+  auto reset() -> void;
+
+private:
+  struct Range {
+    std::atomic<std::uint32_t> min;
+    std::atomic<std::uint32_t> max;
+  };
+
+private:
+  static auto increment(std::atomic<std::uint32_t>& counter) -> void;
+  static auto record(Range& range, std::uint32_t value) -> void;
+  static auto resetRange(Range& range) -> void;
+  static auto getMin(Range const& range) -> std::uint32_t;
+
+private:
+  std::atomic<std::uint32_t> m_framesReceived                        = 0;
+  std::atomic<std::uint32_t> m_framesSent                            = 0;
+  std::array<std::atomic<std::uint32_t>, FIELD_COUNT> m_parityErrors = {};
+  std::atomic<std::uint32_t> m_nakCount                              = 0;
+  std::atomic<std::uint32_t> m_arbitrationLostCount                  = 0;
+  std::atomic<std::uint32_t> m_startBitRejectCount                   = 0;
+  std::atomic<std::uint32_t> m_wakeupMissCount                       = 0;
+  std::atomic<std::uint32_t> m_queueOverflowCount                    = 0;
+  std::atomic<std::uint32_t> m_forwardDropCount                      = 0;
+
+private:
+  Range m_highTime                                                                = {};
+  std::array<std::atomic<std::uint32_t>, HIGH_TIME_BIN_COUNT> m_highTimeHistogram = {};
+
+private:
+  Range m_latency                                                              = {};
+  std::array<std::atomic<std::uint32_t>, LATENCY_BIN_COUNT> m_latencyHistogram = {};
+};
+
+} // namespace iebus
@@ -0,0 +1,170 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <iebus/Message.hpp>
+#include <iebus/MessagePool.hpp>
+
+namespace iebus {
+
+enum class TransmitPriority : std::uint8_t {
+  LOW    = 0,
+  NORMAL = 1,
+  HIGH   = 2,
+  URGENT = 3,
+};
+
+enum class TransmitStatus : std::uint8_t {
+  /**
+   * Frame is transmitted and acknowledged
+   */
+  SENT = 0,
+  /**
+   * All retries failed
+   */
+  FAILED = 1,
+  /**
+   * Deadline passed before the frame was sent
+   */
+  EXPIRED = 2,
+  /**
+   * Receiver task stopped before the frame was sent
+   */
+  CANCELLED = 3,
+};
+
+/**
+ * @class TransmitScheduler
+ * Pending asynchronous transmissions ordered by priority, then by submission order.
+ * Any task may push, a single task serves the entries
+ */
+class TransmitScheduler {
+public:
+  /**
+   * Completion callback invoked on the serving task
+   */
+  using Callback = void (*)(TransmitStatus status, void* context);
+
+  struct Options {
+    TransmitPriority priority = TransmitPriority::NORMAL;
+    /**
+     * Attempts after the first failed one
+     */
+    Size retryCount = 3;
+    /**
+     * Delay before the first retry in ticks, doubled for each next retry
+     */
+    TickType_t backoff = 1;
+    /**
+     * Time in ticks from submission after which the message is dropped, portMAX_DELAY for none
+     */
+    TickType_t timeout = portMAX_DELAY;
+    Callback callback  = nullptr;
+    void* context      = nullptr;
+  };
+
+public:
+  static auto constexpr CAPACITY = 8;
+
+public:
+  TransmitScheduler() noexcept;
+
+public:
+  TransmitScheduler(TransmitScheduler const&)                    = delete;
+  auto operator=(TransmitScheduler const&) -> TransmitScheduler& = delete;
+
+public:
+  /**
+   * Add message
+   * @param message Message owned by the scheduler until completion
+   * @param options Transmission options
+   * @return False if all entries are in use
+   */
+  auto push(MessagePool::Handle message, Options const& options) -> bool;
+
+public:
+  /**
+   * Complete expired entries
+   * @param now Current tick
+   */
+  auto expire(TickType_t now) -> void;
+  /**
+   * Find the entry to transmit next
+   * @param now Current tick
+   * @return Entry index or nullopt if nothing is ready
+   */
+  [[nodiscard]] auto next(TickType_t now) -> std::optional<Size>;
+  /**
+   * Get message of the entry
+   * @param index Entry index
+   * @return Message
+   */
+  [[nodiscard]] auto getMessage(Size index) const -> Message const&;
+  /**
+   * Report transmission attempt, scheduling a retry or completing the entry
+   * @param index Entry index
+   * @param isSent Attempt result
+   * @param now Current tick
+   */
+  auto complete(Size index, bool isSent, TickType_t now) -> void;
+  /**
+   * Get ticks until the next entry is ready
+   * @param now Current tick
+   * @return Ticks or portMAX_DELAY if there are no entries
+   */
+  [[nodiscard]] auto getWaitTime(TickType_t now) -> TickType_t;
+  /**
+   * Complete all entries as cancelled
+   */
+  auto cancel() -> void;
+
+private:
+  struct Entry {
+    MessagePool::Handle message;
+    Options options;
+    Size attempt;
+    TickType_t readyTime;
+    TickType_t deadline;
+    std::uint32_t sequence;
+    bool isUsed;
+  };
+
+private:
+  static auto isReached(TickType_t now, TickType_t time) -> bool;
+
+private:
+  auto finish(Size index, TransmitStatus status) -> void;
+
+private:
+  std::array<Entry, CAPACITY> m_entries = {};
+  std::uint32_t m_sequence              = 0;
+
+private:
+  StaticSemaphore_t m_lockBuffer = {};
+  SemaphoreHandle_t m_lock       = nullptr;
+};
+
+} // namespace iebus
@@ -0,0 +1,99 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/AcceptanceFilter.hpp"
+
+namespace iebus {
+
+namespace {
+
+auto constexpr ADDRESS_MASK = 0x0FFF;
+
+} // namespace
+
+auto AcceptanceFilter::isEmpty() const -> bool {
+  return m_ruleCount == 0;
+}
+
+auto AcceptanceFilter::acceptsAddress(Address const master, Address const slave) const -> bool {
+  if (isEmpty()) {
+    return true;
+  }
+
+  for (Size i = 0; i < m_ruleCount; ++i) {
+    if (matchesAddress(m_rules[i], master, slave)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+auto AcceptanceFilter::accepts(Address const master, Address const slave, Byte const control) const -> bool {
+  if (isEmpty()) {
+    return true;
+  }
+
+  for (Size i = 0; i < m_ruleCount; ++i) {
+    auto const& rule = m_rules[i];
+
+    auto const isControlMatched = ((control ^ rule.control) & rule.controlMask) == 0;
+    if (isControlMatched and matchesAddress(rule, master, slave)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+auto AcceptanceFilter::addRule(Rule const& rule) -> bool {
+  if (m_ruleCount >= m_rules.size()) {
+    return false;
+  }
+
+  m_rules[m_ruleCount++] = rule;
+
+  return true;
+}
+
+auto AcceptanceFilter::addMaster(Address const master) -> bool {
+  return addRule({
+      .master     = master,
+      .masterMask = ADDRESS_MASK,
+  });
+}
+
+auto AcceptanceFilter::addSlave(Address const slave) -> bool {
+  return addRule({
+      .slave     = slave,
+      .slaveMask = ADDRESS_MASK,
+  });
+}
+
+auto AcceptanceFilter::clear() -> void {
+  m_ruleCount = 0;
+}
+
+auto AcceptanceFilter::matchesAddress(Rule const& rule, Address const master, Address const slave) -> bool {
+  auto const isMasterMatched = ((master ^ rule.master) & rule.masterMask) == 0;
+  auto const isSlaveMatched  = ((slave ^ rule.slave) & rule.slaveMask) == 0;
+
+  return isMasterMatched and isSlaveMatched;
+}
+
+} // namespace iebus
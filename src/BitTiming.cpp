@@ -0,0 +1,147 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/BitTiming.hpp"
+
+#include <algorithm>
+
+#include "protocol.hpp"
+
+namespace iebus {
+
+namespace {
+
+/**
+ * Recorded high times needed before the timing is recentred
+ */
+auto constexpr MIN_SAMPLE_COUNT = 256;
+
+/**
+ * Largest deviation of a learned high time from the nominal one
+ */
+auto constexpr MAX_DRIFT_US = 6;
+
+/**
+ * Bins are halved on each update so old samples fade out
+ */
+auto constexpr HISTOGRAM_DECAY_SHIFT = 1;
+
+auto constexpr NOMINAL_TIMING = BitTiming::Timing{
+    .bit0HighUS  = DATA_BIT_0_HIGH_US,
+    .bit1HighUS  = DATA_BIT_1_HIGH_US,
+    .thresholdUS = DATA_BIT_THRESHOLD_US,
+};
+
+auto clampDrift(Time const value, Time const nominal) -> Time {
+  return std::clamp<Time>(value, nominal - MAX_DRIFT_US, nominal + MAX_DRIFT_US);
+}
+
+} // namespace
+
+BitTiming::BitTiming() noexcept : m_timing(NOMINAL_TIMING) {
+}
+
+auto BitTiming::isAdaptive() const -> bool {
+  return m_isAdaptive;
+}
+
+auto BitTiming::getTiming() const -> Timing {
+  return m_timing;
+}
+
+auto BitTiming::classify(Time const highTimeUS) const -> Bit {
+  if (highTimeUS < m_timing.thresholdUS) {
+    return 1;
+  }
+
+  return 0;
+}
+
+auto BitTiming::setAdaptive(bool const isAdaptive) -> void {
+  m_isAdaptive = isAdaptive;
+
+  if (not isAdaptive) {
+    reset();
+  }
+}
+
+auto BitTiming::decode(Time const highTimeUS) -> Bit {
+  if (m_isAdaptive and highTimeUS >= 0 and highTimeUS < HISTOGRAM_SIZE) {
+    auto& bin = m_histogram[static_cast<Size>(highTimeUS)];
+    if (bin < UINT16_MAX) {
+      bin++;
+      m_sampleCount++;
+    }
+  }
+
+  return classify(highTimeUS);
+}
+
+auto BitTiming::update() -> bool {
+  if (not m_isAdaptive or m_sampleCount < MIN_SAMPLE_COUNT) {
+    return false;
+  }
+
+  std::uint32_t bit1Count = 0;
+  std::uint32_t bit1Sum   = 0;
+  std::uint32_t bit0Count = 0;
+  std::uint32_t bit0Sum   = 0;
+
+  for (Size i = 0; i < m_histogram.size(); ++i) {
+    auto const count = m_histogram[i];
+
+    if (static_cast<Time>(i) < m_timing.thresholdUS) {
+      bit1Count += count;
+      bit1Sum += count * static_cast<std::uint32_t>(i);
+    } else {
+      bit0Count += count;
+      bit0Sum += count * static_cast<std::uint32_t>(i);
+    }
+
+    m_histogram[i] = count >> HISTOGRAM_DECAY_SHIFT;
+  }
+
+  m_sampleCount >>= HISTOGRAM_DECAY_SHIFT;
+
+  if (bit1Count == 0 or bit0Count == 0) {
+    return false;
+  }
+
+  auto const bit1HighUS = clampDrift((bit1Sum + bit1Count / 2) / bit1Count, DATA_BIT_1_HIGH_US);
+  auto const bit0HighUS = clampDrift((bit0Sum + bit0Count / 2) / bit0Count, DATA_BIT_0_HIGH_US);
+
+  Timing const timing = {
+      .bit0HighUS  = bit0HighUS,
+      .bit1HighUS  = bit1HighUS,
+      .thresholdUS = (bit0HighUS + bit1HighUS + 1) / 2,
+  };
+
+  auto const isChanged = timing.bit0HighUS != m_timing.bit0HighUS or timing.bit1HighUS != m_timing.bit1HighUS;
+
+  m_timing = timing;
+
+  return isChanged;
+}
+
+auto BitTiming::reset() -> void {
+  m_timing = NOMINAL_TIMING;
+  m_histogram.fill(0);
+  m_sampleCount = 0;
+}
+
+} // namespace iebus
@@ -0,0 +1,115 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/CompactMessage.hpp"
+
+#include <algorithm>
+
+#include <iebus/MessageFormatter.hpp>
+
+#include "formatting.hpp"
+
+namespace iebus {
+
+auto CompactMessage::getBroadcast() const -> BroadcastType {
+  return m_broadcast;
+}
+
+auto CompactMessage::getMaster() const -> Address {
+  return m_master;
+}
+
+auto CompactMessage::getSlave() const -> Address {
+  return m_slave;
+}
+
+auto CompactMessage::getControl() const -> Byte {
+  return m_control;
+}
+
+auto CompactMessage::getDataLength() const -> Size {
+  return m_dataLength;
+}
+
+auto CompactMessage::getData() const -> std::span<Byte const> {
+  if (isOverflowed()) {
+    return std::span<Byte const>(m_overflow->data).first(m_dataLength);
+  }
+
+  return std::span<Byte const>(m_inlineData).first(m_dataLength);
+}
+
+auto CompactMessage::isOverflowed() const -> bool {
+  return static_cast<bool>(m_overflow);
+}
+
+auto CompactMessage::assign(Message const& message, MessagePool& overflow) -> bool {
+  auto const length = std::min<Size>(message.dataLength, message.data.size());
+
+  return assign(message.broadcast, message.master, message.slave, message.control, std::span(message.data).first(length), overflow);
+}
+
+auto CompactMessage::assign(BroadcastType const broadcast, Address const master, Address const slave, Byte const control, std::span<Byte const> const data,
+                            MessagePool& overflow) -> bool {
+  auto const length = std::min<Size>(data.size(), MAX_MESSAGE_SIZE);
+
+  if (length <= m_inlineData.size()) {
+    m_overflow.reset();
+    std::copy_n(data.begin(), length, m_inlineData.begin());
+  } else {
+    if (not m_overflow) {
+      m_overflow = overflow.acquire();
+    }
+
+    if (not m_overflow) {
+      return false;
+    }
+
+    std::copy_n(data.begin(), length, m_overflow->data.begin());
+  }
+
+  m_broadcast  = broadcast;
+  m_master     = master;
+  m_slave      = slave;
+  m_control    = control;
+  m_dataLength = static_cast<std::uint16_t>(length);
+
+  return true;
+}
+
+auto CompactMessage::toMessage(Message& message) const -> void {
+  auto const data = getData();
+
+  message.broadcast  = m_broadcast;
+  message.master     = m_master;
+  message.slave      = m_slave;
+  message.control    = m_control;
+  message.dataLength = data.size();
+
+  std::copy(data.begin(), data.end(), message.data.begin());
+}
+
+auto CompactMessage::format(std::span<char> const buffer) const -> Size {
+  return MessageFormatter::format(buffer, m_broadcast, m_master, m_slave, m_control, getData());
+}
+
+auto CompactMessage::toString() const -> std::string {
+  return formatMessage(m_broadcast, m_master, m_slave, m_control, getData());
+}
+
+} // namespace iebus
@@ -18,8 +18,12 @@
 
 #include "iebus/Controller.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <esp_log.h>
 #include <esp_timer.h>
+#include <sdkconfig.h>
 #include <utility>
 
 #include "common.hpp"
@@ -30,15 +34,52 @@ namespace {
 
 auto constexpr TAG = "IEBusController";
 
-auto constexpr MASTER_ADDRESS_BIT_SIZE = 12;
-auto constexpr SLAVE_ADDRESS_BIT_SIZE  = 12;
-auto constexpr CONTROL_BIT_SIZE        = 4;
-auto constexpr DATA_LENGTH_BIT_SIZE    = 8;
-auto constexpr DATA_BIT_SIZE           = 8;
+auto constexpr RECEIVER_TASK_NAME       = "iebus_receiver";
+auto constexpr RECEIVER_STACK_SIZE      = 4096;
+auto constexpr RECEIVER_POLL_TIMEOUT_MS = 10;
+auto constexpr RECEIVER_POLL_TIMEOUT    = pdMS_TO_TICKS(RECEIVER_POLL_TIMEOUT_MS) > 0 ? pdMS_TO_TICKS(RECEIVER_POLL_TIMEOUT_MS) : 1;
+auto constexpr DISPATCH_TASK_NAME       = "iebus_dispatch";
+auto constexpr DISPATCH_STACK_SIZE      = 4096;
+auto constexpr TRANSMIT_QUEUE_SIZE      = 4;
+auto constexpr TRANSMIT_RETRY_DELAY_MS  = 1;
+auto constexpr TRANSMIT_RETRY_DELAY     = pdMS_TO_TICKS(TRANSMIT_RETRY_DELAY_MS) > 0 ? pdMS_TO_TICKS(TRANSMIT_RETRY_DELAY_MS) : 1;
+auto constexpr DECODING_MESSAGE_COUNT   = 1;
+auto constexpr SEGMENT_RETRY_COUNT      = 3;
+
+/**
+ * Bus free wait of transmissions on a shared receiver task, the other buses of the task are not served meanwhile
+ */
+auto constexpr SHARED_BUS_FREE_TIMEOUT_MS = 5;
+auto constexpr SHARED_BUS_FREE_TIMEOUT    = pdMS_TO_TICKS(SHARED_BUS_FREE_TIMEOUT_MS) > 0 ? pdMS_TO_TICKS(SHARED_BUS_FREE_TIMEOUT_MS) : 1;
 
 } // namespace
 
-Controller::Controller(Driver::Pin const rx, Driver::Pin const tx, Driver::Pin const enable, Address const address) noexcept : m_address(address), m_driver(rx, tx, enable) {
+Controller::Controller(Driver::Pin const rx, Driver::Pin const tx, Driver::Pin const enable, Address const address, ReceiveMode const receiveMode,
+                       TransmitMode const transmitMode) noexcept
+    : m_address(address), m_driver(rx, tx, enable, receiveMode, transmitMode), m_transmitLock(xSemaphoreCreateMutexStatic(&m_transmitLockBuffer)) {
+  m_localAddresses[address & ADDRESS_MASK] = true;
+}
+
+Controller::Controller(Backend& backend, Address const address) noexcept
+    : m_address(address), m_driver(backend), m_transmitLock(xSemaphoreCreateMutexStatic(&m_transmitLockBuffer)) {
+  m_localAddresses[address & ADDRESS_MASK] = true;
+}
+
+Controller::~Controller() {
+  stopReceiver();
+
+  for (Size i = 0; i < m_localDeviceCount; ++i) {
+    auto& device = m_localDevices[i];
+    if (device.queue == nullptr) {
+      continue;
+    }
+
+    while (read(device.address, 0)) {
+    }
+
+    vQueueDelete(device.queue);
+    device.queue = nullptr;
+  }
 }
 
 auto Controller::enable() -> void {
@@ -46,6 +87,7 @@ auto Controller::enable() -> void {
 }
 
 auto Controller::disable() -> void {
+  stopReceiver();
   m_driver.disable();
 }
 
@@ -53,245 +95,1244 @@ auto Controller::isEnabled() const -> bool {
   return m_driver.isEnabled();
 }
 
-auto Controller::readMessage() -> std::optional<Message> {
+auto Controller::isReceiverRunning() const -> bool {
+  return m_isReceiverRunning.load();
+}
+
+auto Controller::getDroppedCount() const -> std::uint32_t {
+  return m_droppedCount.load(std::memory_order_relaxed);
+}
+
+auto Controller::getDiagnostics() -> Diagnostics& {
+  return m_diagnostics;
+}
+
+auto Controller::getStatistics() -> Statistics& {
+  return m_driver.getStatistics();
+}
+
+auto Controller::getAcceptanceFilter() -> AcceptanceFilter& {
+  return m_acceptanceFilter;
+}
+
+auto Controller::isLocalAddress(Address const address) const -> bool {
+  return m_localAddresses[address & ADDRESS_MASK];
+}
+
+auto Controller::addLocalAddress(Address const address, Size const capacity, Handler const handler, void* const context) -> bool {
+  if (isReceiverRunning()) {
+    ESP_LOGE(TAG, "Receiver task is running");
+    return false;
+  }
+
+  if (address == m_address or findLocalDevice(address) != nullptr) {
+    ESP_LOGE(TAG, "Address %#05x is already local", address);
+    return false;
+  }
+
+  if (m_localDeviceCount >= m_localDevices.size()) {
+    ESP_LOGE(TAG, "Too many local addresses");
+    return false;
+  }
+
+  QueueHandle_t queue = nullptr;
+
+  if (capacity > 0) {
+    queue = xQueueCreate(capacity, sizeof(Message*));
+    if (queue == nullptr) {
+      ESP_LOGE(TAG, "Failed to allocate queue for address %#05x", address);
+      return false;
+    }
+  }
+
+  m_localDevices[m_localDeviceCount++] = {
+      .address  = address,
+      .capacity = capacity,
+      .handler  = handler,
+      .context  = context,
+      .queue    = queue,
+  };
+
+  m_localAddresses[address & ADDRESS_MASK] = true;
+
+  return true;
+}
+
+auto Controller::setSniffer(Sniffer* const sniffer) -> void {
+  m_sniffer = sniffer;
+}
+
+auto Controller::setAckMode(AckMode const ackMode) -> bool {
+  return m_driver.setAckMode(ackMode);
+}
+
+auto Controller::setLowPowerListen(bool const isLowPowerListen) -> bool {
+  return m_driver.setLowPowerListen(isLowPowerListen);
+}
+
+auto Controller::startReceiver(BaseType_t const core, UBaseType_t const priority, Size const capacity) -> bool {
+  if (isReceiverRunning()) {
+    return true;
+  }
+
+  if (not isSingleCoreAffinity(core)) {
+    ESP_LOGE(TAG, "Receiver task has to be pinned, bit timing uses the per core cycle counter");
+    return false;
+  }
+
+  auto const isPrepared = prepareReceiver(capacity);
+  if (not isPrepared) {
+    return false;
+  }
+
+  m_isReceiverRunning = true;
+
+  auto const isCreated = xTaskCreatePinnedToCore(receiverTask, RECEIVER_TASK_NAME, RECEIVER_STACK_SIZE, this, priority, &m_receiverTask, core) == pdPASS;
+  if (not isCreated) {
+    ESP_LOGE(TAG, "Failed to create receiver task");
+    m_isReceiverRunning = false;
+    m_receiverTask      = nullptr;
+    stopReceiver();
+    return false;
+  }
+
+  return true;
+}
+
+auto Controller::attachReceiver(TaskHandle_t const task, Size const capacity) -> bool {
+  if (isReceiverRunning()) {
+    ESP_LOGE(TAG, "Receiver task is running");
+    return false;
+  }
+
+  if (m_driver.getReceiveMode() == ReceiveMode::POLLING) {
+    ESP_LOGE(TAG, "Polling receive needs its own receiver task");
+    return false;
+  }
+
+  auto const isPrepared = prepareReceiver(capacity);
+  if (not isPrepared) {
+    return false;
+  }
+
+  m_receiverTask       = task;
+  m_isReceiverAttached = true;
+  m_isReceiverRunning  = true;
+
+  return true;
+}
+
+auto Controller::detachReceiver() -> void {
+  if (not m_isReceiverAttached) {
+    return;
+  }
+
+  xSemaphoreTake(m_transmitLock, portMAX_DELAY);
+  m_isReceiverRunning = false;
+  xSemaphoreGive(m_transmitLock);
+
+  rejectTransmitRequests();
+  m_transmitScheduler.cancel();
+
+  m_receiverTask       = nullptr;
+  m_isReceiverAttached = false;
+
+  releaseReceiver();
+}
+
+auto Controller::setForwarding(Controller* const target, ForwardFilter const filter, void* const context, TransmitScheduler::Options const& options) -> void {
+  m_forwardTarget  = target;
+  m_forwardFilter  = filter;
+  m_forwardContext = context;
+  m_forwardOptions = options;
+}
+
+auto Controller::prepareReceiver(Size const capacity) -> bool {
+  if (not isEnabled()) {
+    ESP_LOGE(TAG, "Controller is disabled");
+    return false;
+  }
+
+  auto poolCapacity = capacity + DECODING_MESSAGE_COUNT;
+
+  if (m_isDispatchRunning) {
+    poolCapacity += DISPATCH_RING_SIZE;
+  }
+
+  for (Size i = 0; i < m_localDeviceCount; ++i) {
+    poolCapacity += m_localDevices[i].capacity;
+  }
+
+  auto const isPoolCreated = m_messagePool.create(poolCapacity);
+  if (not isPoolCreated) {
+    return false;
+  }
+
+  auto const isTransmitPoolCreated = m_transmitPool.create(TransmitScheduler::CAPACITY);
+  if (not isTransmitPoolCreated) {
+    return false;
+  }
+
+  m_receiveQueue  = xQueueCreate(capacity, sizeof(Message*));
+  m_transmitQueue = xQueueCreate(TRANSMIT_QUEUE_SIZE, sizeof(TransmitRequest));
+
+  if (m_receiveQueue == nullptr or m_transmitQueue == nullptr) {
+    ESP_LOGE(TAG, "Failed to allocate receiver queues");
+    releaseReceiver();
+    return false;
+  }
+
+  m_droppedCount = 0;
+
+  return true;
+}
+
+auto Controller::releaseReceiver() -> void {
+  if (m_receiveQueue != nullptr) {
+    while (tryRead()) {
+    }
+
+    vQueueDelete(m_receiveQueue);
+    m_receiveQueue = nullptr;
+  }
+
+  if (m_transmitQueue != nullptr) {
+    vQueueDelete(m_transmitQueue);
+    m_transmitQueue = nullptr;
+  }
+}
+
+auto Controller::startPipeline(BaseType_t const receiverCore, BaseType_t const dispatchCore, UBaseType_t const priority, Size const capacity) -> bool {
+  if (isReceiverRunning()) {
+    return true;
+  }
+
+  m_isDispatchRunning = true;
+
+  auto const isCreated = xTaskCreatePinnedToCore(dispatchTask, DISPATCH_TASK_NAME, DISPATCH_STACK_SIZE, this, priority, &m_dispatchTask, dispatchCore) == pdPASS;
+  if (not isCreated) {
+    ESP_LOGE(TAG, "Failed to create dispatch task");
+    m_isDispatchRunning = false;
+    m_dispatchTask      = nullptr;
+    return false;
+  }
+
+  auto const isStarted = startReceiver(receiverCore, priority, capacity);
+  if (not isStarted) {
+    stopReceiver();
+    return false;
+  }
+
+  return true;
+}
+
+auto Controller::stopReceiver() -> void {
+  if (isReceiverTask() or isDispatchTask()) {
+    ESP_LOGE(TAG, "Receiver task can not stop itself");
+    return;
+  }
+
+  if (m_isReceiverAttached) {
+    ESP_LOGE(TAG, "Receiver is owned by a controller group");
+    return;
+  }
+
+  if (m_receiverTask != nullptr) {
+    m_stoppingTask = xTaskGetCurrentTaskHandle();
+
+    xSemaphoreTake(m_transmitLock, portMAX_DELAY);
+    m_isReceiverRunning = false;
+    xSemaphoreGive(m_transmitLock);
+
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    m_receiverTask = nullptr;
+    m_stoppingTask = nullptr;
+  }
+
+  if (m_dispatchTask != nullptr) {
+    m_stoppingTask = xTaskGetCurrentTaskHandle();
+
+    m_isDispatchRunning = false;
+    xTaskNotifyGive(m_dispatchTask);
+
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    m_dispatchTask = nullptr;
+    m_stoppingTask = nullptr;
+  }
+
+  releaseReceiver();
+}
+
+auto Controller::tryRead() -> MessagePool::Handle {
+  return read(0);
+}
+
+auto Controller::read(TickType_t const timeout) -> MessagePool::Handle {
+  if (m_receiveQueue == nullptr) {
+    return {};
+  }
+
+  Message* message = nullptr;
+
+  auto const isReceived = xQueueReceive(m_receiveQueue, &message, timeout) == pdTRUE;
+  if (not isReceived) {
+    return {};
+  }
+
+  return m_messagePool.attach(message);
+}
+
+auto Controller::read(Address const address, TickType_t const timeout) -> MessagePool::Handle {
+  auto const* const device = findLocalDevice(address);
+  if (device == nullptr or device->queue == nullptr) {
+    return {};
+  }
+
+  Message* message = nullptr;
+
+  auto const isReceived = xQueueReceive(device->queue, &message, timeout) == pdTRUE;
+  if (not isReceived) {
+    return {};
+  }
+
+  return m_messagePool.attach(message);
+}
+
+auto Controller::readMessage(TickType_t const timeout) -> std::optional<Message> {
   if (not isEnabled()) {
     ESP_LOGE(TAG, "Controller is disabled");
     return std::nullopt;
   }
 
-  if (not m_driver.receiveStartBit()) {
+  if (isReceiverRunning()) {
+    ESP_LOGE(TAG, "Receiver task is running");
     return std::nullopt;
   }
 
   Message message = {};
 
-  {
-    auto const broadcastBit = m_driver.receiveBit();
-    if (broadcastBit == 0) {
-      message.broadcast = BroadcastType::BROADCAST;
-    } else {
-      message.broadcast = BroadcastType::FOR_DEVICE;
-    }
+  auto const isReceived = receiveMessage(message, timeout);
+  if (not isReceived) {
+    return std::nullopt;
   }
 
-  {
-    message.master = m_driver.receiveBits(MASTER_ADDRESS_BIT_SIZE);
+  recordLatency(m_driver.getFrameStartTime());
 
-    auto const masterParityBit = m_driver.receiveBit();
-    auto const isParityValid   = checkParity(message.master, MASTER_ADDRESS_BIT_SIZE, masterParityBit);
-    if (not isParityValid) {
-      ESP_LOGW(TAG, "Master address parity error");
-      return std::nullopt;
-    }
+  return message;
+}
+
+auto Controller::readMessage(CompactMessage& message, MessagePool& overflow, TickType_t const timeout) -> bool {
+  auto const received = readMessage(timeout);
+  if (not received) {
+    return false;
   }
 
-  {
-    message.slave = m_driver.receiveBits(SLAVE_ADDRESS_BIT_SIZE);
+  auto const isStored = message.assign(*received, overflow);
+  if (not isStored) {
+    ESP_LOGW(TAG, "Overflow pool is exhausted");
+    return false;
+  }
 
-    auto const parityBit       = m_driver.receiveBit();
-    auto const isParityValid   = checkParity(message.slave, SLAVE_ADDRESS_BIT_SIZE, parityBit);
-    auto const ackBit          = m_driver.receiveAckBit();
-    auto const isNeedAnswer    = ackBit == AcknowledgmentType::ACK;
-    auto const isForDevice     = message.broadcast == BroadcastType::FOR_DEVICE;
-    auto const isForThisDevice = message.slave == m_address;
-    auto const isAnswer        = isNeedAnswer and isForDevice and isForThisDevice;
+  return true;
+}
 
-    if (not isParityValid) {
-      if (isAnswer) {
-        m_driver.sendAckBit(AcknowledgmentType::NAK);
-      }
+auto Controller::readStream(StreamHandler const& handler, std::span<Byte> const buffer, Size const chunkSize, TickType_t const timeout) -> bool {
+  if (not isEnabled()) {
+    ESP_LOGE(TAG, "Controller is disabled");
+    return false;
+  }
+
+  if (isReceiverRunning()) {
+    ESP_LOGE(TAG, "Receiver task is running");
+    return false;
+  }
+
+  if (buffer.empty() or chunkSize == 0) {
+    ESP_LOGE(TAG, "Stream buffer is empty");
+    return false;
+  }
+
+  if (not m_driver.receiveStartBit(timeout)) {
+    return false;
+  }
+
+  Message header = {};
+
+  auto const isHeaderReceived = decodeHeader(header);
+  if (not isHeaderReceived) {
+    return false;
+  }
 
-      ESP_LOGW(TAG, "Slave address parity error");
-      return std::nullopt;
+  auto const isAccepted = handler.onHeader == nullptr or handler.onHeader(header, handler.context);
+  if (not isAccepted) {
+    m_driver.skipFrame();
+    return false;
+  }
+
+  Size chunkOffset = 0;
+
+  for (Size i = 0; i < header.dataLength; i++) {
+    auto const position = i % buffer.size();
+
+    auto const isReceived = receiveField<DataField>(buffer[position], header, FrameField::DATA, i);
+    if (not isReceived) {
+      return false;
     }
 
-    if (isAnswer) {
-      m_driver.sendAckBit(AcknowledgmentType::ACK);
+    auto const chunkLength = i + 1 - chunkOffset;
+    auto const isChunkEnd  = chunkLength == chunkSize or position + 1 == buffer.size() or i + 1 == header.dataLength;
+    if (not isChunkEnd) {
+      continue;
+    }
+
+    auto const chunk = std::span<Byte const>(buffer).subspan(position + 1 - chunkLength, chunkLength);
+
+    auto const isContinued = handler.onData == nullptr or handler.onData(chunk, chunkOffset, handler.context);
+    if (not isContinued) {
+      m_driver.skipFrame();
+      return false;
     }
+
+    chunkOffset = i + 1;
   }
 
-  {
-    message.control = m_driver.receiveBits(CONTROL_BIT_SIZE);
+  m_driver.getStatistics().countFrameReceived();
+  recordLatency(m_driver.getFrameStartTime());
 
-    auto const parityBit       = m_driver.receiveBit();
-    auto const isParityValid   = checkParity(message.control, CONTROL_BIT_SIZE, parityBit);
-    auto const ackBit          = m_driver.receiveAckBit();
-    auto const isNeedAnswer    = ackBit == AcknowledgmentType::ACK;
-    auto const isForDevice     = message.broadcast == BroadcastType::FOR_DEVICE;
-    auto const isForThisDevice = message.slave == m_address;
-    auto const isAnswer        = isNeedAnswer and isForDevice and isForThisDevice;
+  return true;
+}
 
-    if (not isParityValid) {
-      if (isAnswer) {
-        m_driver.sendAckBit(AcknowledgmentType::NAK);
-      }
+auto Controller::readSegment(Reassembler& reassembler, TickType_t const timeout) -> Reassembler::Status {
+  if (not isEnabled()) {
+    ESP_LOGE(TAG, "Controller is disabled");
+    return Reassembler::Status::INVALID;
+  }
+
+  if (isReceiverRunning()) {
+    ESP_LOGE(TAG, "Receiver task is running");
+    return Reassembler::Status::INVALID;
+  }
 
-      ESP_LOGW(TAG, "Control parity error");
-      return std::nullopt;
+  if (not m_driver.receiveStartBit(timeout)) {
+    return Reassembler::Status::INVALID;
+  }
+
+  Message header = {};
+
+  auto const isHeaderReceived = decodeHeader(header);
+  if (not isHeaderReceived) {
+    return Reassembler::Status::INVALID;
+  }
+
+  if (header.dataLength < SEGMENT_HEADER_SIZE) {
+    m_driver.skipFrame();
+    return Reassembler::Status::INVALID;
+  }
+
+  std::array<Byte, SEGMENT_HEADER_SIZE> segmentHeader = {};
+
+  for (Size i = 0; i < segmentHeader.size(); i++) {
+    auto const isReceived = receiveField<DataField>(segmentHeader[i], header, FrameField::DATA, i);
+    if (not isReceived) {
+      return Reassembler::Status::INVALID;
     }
+  }
 
-    if (isAnswer) {
-      m_driver.sendAckBit(AcknowledgmentType::ACK);
+  auto const status = reassembler.prepare(header.master, segmentHeader, header.dataLength - SEGMENT_HEADER_SIZE);
+  if (status != Reassembler::Status::IN_PROGRESS) {
+    m_driver.skipFrame();
+    return status;
+  }
+
+  auto const payload = reassembler.getSegmentBuffer();
+
+  for (Size i = 0; i < payload.size(); i++) {
+    auto const isReceived = receiveField<DataField>(payload[i], header, FrameField::DATA, SEGMENT_HEADER_SIZE + i);
+    if (not isReceived) {
+      return Reassembler::Status::INVALID;
     }
   }
 
-  {
-    message.dataLength = m_driver.receiveBits(DATA_LENGTH_BIT_SIZE);
+  m_driver.getStatistics().countFrameReceived();
+  recordLatency(m_driver.getFrameStartTime());
 
-    auto const parityBit       = m_driver.receiveBit();
-    auto const isParityValid   = checkParity(message.dataLength, DATA_LENGTH_BIT_SIZE, parityBit);
-    auto const ackBit          = m_driver.receiveAckBit();
-    auto const isNeedAnswer    = ackBit == AcknowledgmentType::ACK;
-    auto const isForDevice     = message.broadcast == BroadcastType::FOR_DEVICE;
-    auto const isForThisDevice = message.slave == m_address;
-    auto const isAnswer        = isNeedAnswer and isForDevice and isForThisDevice;
+  return reassembler.commit();
+}
 
-    if (not isParityValid) {
-      if (isAnswer) {
-        m_driver.sendAckBit(AcknowledgmentType::NAK);
-      }
+auto Controller::writeMessage(Message const& message) -> bool {
+  auto const length = message.dataLength < message.data.size() ? message.dataLength : message.data.size();
+
+  MessageView const view = {
+      .broadcast = message.broadcast,
+      .master    = message.master,
+      .slave     = message.slave,
+      .control   = message.control,
+      .data      = std::span(message.data).first(length),
+  };
+
+  return submitMessage(view);
+}
+
+auto Controller::writeMessage(CompactMessage const& message) -> bool {
+  MessageView const view = {
+      .broadcast = message.getBroadcast(),
+      .master    = message.getMaster(),
+      .slave     = message.getSlave(),
+      .control   = message.getControl(),
+      .data      = message.getData(),
+  };
+
+  return submitMessage(view);
+}
+
+auto Controller::writeMessages(std::span<Message const> const messages) -> BatchResult {
+  if (not isEnabled()) {
+    ESP_LOGE(TAG, "Controller is disabled");
+    return 0;
+  }
+
+  if (messages.size() > MAX_BATCH_SIZE) {
+    ESP_LOGE(TAG, "Batch of %u messages is too long", messages.size());
+    return 0;
+  }
+
+  if (isReceiverTask()) {
+    return transmitBatch(messages);
+  }
+
+  TransmitRequest const request = {
+      .message    = nullptr,
+      .transfer   = nullptr,
+      .batch      = messages,
+      .completion = nullptr,
+  };
+
+  auto const result = requestTransmit(request);
+  if (not result) {
+    return transmitBatch(messages);
+  }
+
+  return *result;
+}
+
+auto Controller::writeSegmented(BroadcastType const broadcast, Address const master, Address const slave, Byte const control, std::span<Byte const> const data,
+                                Size const window) -> bool {
+  if (not isEnabled()) {
+    ESP_LOGE(TAG, "Controller is disabled");
+    return false;
+  }
+
+  if (data.size() > MAX_SEGMENTED_SIZE) {
+    ESP_LOGE(TAG, "Transfer of %u bytes is too long", data.size());
+    return false;
+  }
 
-      ESP_LOGW(TAG, "Length parity error");
-      return std::nullopt;
+  SegmentedTransfer transfer = {
+      .message =
+          {
+              .broadcast = broadcast,
+              .master    = master,
+              .slave     = slave,
+              .control   = control,
+              .data      = data,
+          },
+      .window       = window > 0 ? window : 1,
+      .nextSegment  = 0,
+      .segmentCount = getSegmentCount(data.size()),
+      .completion   = nullptr,
+      .isFailed     = false,
+  };
+
+  TransmitRequest const request = {
+      .message    = nullptr,
+      .transfer   = &transfer,
+      .batch      = {},
+      .completion = nullptr,
+  };
+
+  if (not isReceiverTask()) {
+    auto const result = requestTransmit(request);
+    if (result) {
+      return *result != 0;
     }
+  }
 
-    if (isAnswer) {
-      m_driver.sendAckBit(AcknowledgmentType::ACK);
+  while (transmitSegments(transfer)) {
+  }
+
+  return not transfer.isFailed;
+}
+
+auto Controller::submitMessage(MessageView const& message) -> bool {
+  if (not isEnabled()) {
+    ESP_LOGE(TAG, "Controller is disabled");
+    return false;
+  }
+
+  if (isReceiverTask()) {
+    return transmitMessage(message);
+  }
+
+  TransmitRequest const request = {
+      .message    = &message,
+      .transfer   = nullptr,
+      .batch      = {},
+      .completion = nullptr,
+  };
+
+  auto const result = requestTransmit(request);
+  if (not result) {
+    return transmitMessage(message);
+  }
+
+  return *result != 0;
+}
+
+auto Controller::scheduleMessage(Message const& message, TransmitScheduler::Options const& options) -> bool {
+  if (not isReceiverRunning()) {
+    ESP_LOGE(TAG, "Receiver task is not running");
+    return false;
+  }
+
+  auto copy = m_transmitPool.acquire();
+  if (not copy) {
+    return false;
+  }
+
+  *copy = message;
+
+  return scheduleTransmit(std::move(copy), options);
+}
+
+auto Controller::receiverTask(void* const context) -> void {
+  auto* const controller = static_cast<Controller*>(context);
+
+  while (controller->isReceiverRunning()) {
+    static_cast<void>(controller->serviceReceiver(RECEIVER_POLL_TIMEOUT));
+  }
+
+  controller->rejectTransmitRequests();
+  controller->m_transmitScheduler.cancel();
+
+  xTaskNotifyGive(controller->m_stoppingTask);
+  vTaskDelete(nullptr);
+}
+
+auto Controller::serviceReceiver(TickType_t const timeout) -> bool {
+  if (not isReceiverRunning()) {
+    return false;
+  }
+
+  serveTransmitRequests();
+  serveScheduledMessages();
+
+  auto const waitTime    = m_transmitScheduler.getWaitTime(xTaskGetTickCount());
+  auto const waitTimeout = waitTime < timeout ? waitTime : timeout;
+
+  if (m_sniffer != nullptr) {
+    auto const isStarted = m_driver.receiveStartBit(waitTimeout);
+    if (isStarted) {
+      captureFrame();
     }
 
-    if (message.dataLength == 0) {
-      message.dataLength = 256;
+    return isStarted;
+  }
+
+  auto message = m_messagePool.acquire();
+  if (not message) {
+    Message discarded = {};
+
+    auto const isReceived = receiveMessage(discarded, waitTimeout);
+    if (isReceived) {
+      countDropped();
     }
+
+    return isReceived;
   }
 
-  for (Size i = 0; i < message.dataLength; i++) {
-    message.data[i] = m_driver.receiveBits(DATA_BIT_SIZE);
-
-    auto const parityBit       = m_driver.receiveBit();
-    auto const isParityValid   = checkParity(message.data[i], DATA_BIT_SIZE, parityBit);
-    auto const ackBit          = m_driver.receiveAckBit();
-    auto const isNeedAnswer    = ackBit == AcknowledgmentType::ACK;
-    auto const isForDevice     = message.broadcast == BroadcastType::FOR_DEVICE;
-    auto const isForThisDevice = message.slave == m_address;
-    auto const isAnswer        = isNeedAnswer and isForDevice and isForThisDevice;
-
-    if (not isParityValid) {
-      if (isAnswer) {
-        m_driver.sendAckBit(AcknowledgmentType::NAK);
-      }
+  auto const isReceived = receiveMessage(*message, waitTimeout);
+  if (not isReceived) {
+    return false;
+  }
+
+  deliverMessage(std::move(message));
 
-      ESP_LOGW(TAG, "Data byte %u parity error", i);
-      return std::nullopt;
+  return true;
+}
+
+auto Controller::prepareIdleWait(TickType_t const timeout) -> TickType_t {
+  if (not isReceiverRunning()) {
+    return timeout;
+  }
+
+  auto const isArmed = m_driver.armWakeup(m_receiverTask);
+  if (not isArmed or m_activeTransfer != nullptr or uxQueueMessagesWaiting(m_transmitQueue) > 0) {
+    return 0;
+  }
+
+  auto const waitTime = m_transmitScheduler.getWaitTime(xTaskGetTickCount());
+
+  return waitTime < timeout ? waitTime : timeout;
+}
+
+auto Controller::dispatchTask(void* const context) -> void {
+  auto* const controller = static_cast<Controller*>(context);
+
+  while (true) {
+    auto const decoded = controller->m_dispatchRing.pop();
+    if (decoded) {
+      controller->dispatchMessage(controller->m_messagePool.attach(decoded->message), decoded->frameStartTime);
+      continue;
     }
 
-    if (isAnswer) {
-      m_driver.sendAckBit(AcknowledgmentType::ACK);
+    // Ring is drained before exit, the receiver task is already stopped at this point
+    if (not controller->m_isDispatchRunning) {
+      break;
     }
+
+    ulTaskNotifyTake(pdTRUE, RECEIVER_POLL_TIMEOUT);
   }
 
-  return message;
+  xTaskNotifyGive(controller->m_stoppingTask);
+  vTaskDelete(nullptr);
 }
 
-auto Controller::writeMessage(Message const& message) -> bool {
-  if (not isEnabled()) {
-    ESP_LOGE(TAG, "Controller is disabled");
-    return false;
+auto Controller::deliverMessage(MessagePool::Handle message) -> void {
+  auto const frameStartTime = m_driver.getFrameStartTime();
+
+  if (m_dispatchTask == nullptr) {
+    return dispatchMessage(std::move(message), frameStartTime);
   }
 
-  while (not m_driver.isBusFree()) {
-    delayUS(1);
+  auto* const decoded = message.detach();
+
+  auto const isPushed = m_dispatchRing.push({.message = decoded, .frameStartTime = frameStartTime});
+  if (not isPushed) {
+    m_messagePool.attach(decoded).reset();
+    countDropped();
+    return;
+  }
+
+  xTaskNotifyGive(m_dispatchTask);
+}
+
+auto Controller::dispatchMessage(MessagePool::Handle message, Time const frameStartTime) -> void {
+  auto const isForwarded = m_forwardTarget != nullptr and not isLocalAddress(message->slave) and
+                           (m_forwardFilter == nullptr or m_forwardFilter(*message, m_forwardContext));
+  if (isForwarded) {
+    return forwardMessage(std::move(message), frameStartTime);
   }
 
-  m_driver.transmitStartBit();
+  auto queue = m_receiveQueue;
+
+  auto const* const device = message->broadcast == BroadcastType::FOR_DEVICE ? findLocalDevice(message->slave) : nullptr;
+  if (device != nullptr) {
+    if (device->handler != nullptr) {
+      device->handler(*message, device->context);
+    }
 
-  if (message.broadcast == BroadcastType::BROADCAST) {
-    m_driver.transmitBit(0);
-  } else {
-    m_driver.transmitBit(1);
+    queue = device->queue;
+    if (queue == nullptr) {
+      recordLatency(frameStartTime);
+      return;
+    }
   }
 
-  {
-    m_driver.transmitBits(message.master, 12);
+  auto* const received = message.detach();
 
-    auto const parityBit = calculateParity(message.master, 12);
-    m_driver.transmitBit(parityBit);
+  auto const isQueued = xQueueSend(queue, &received, 0) == pdTRUE;
+  if (not isQueued) {
+    m_messagePool.attach(received).reset();
+    countDropped();
+    return;
   }
 
-  {
-    m_driver.transmitBits(message.slave, 12);
+  recordLatency(frameStartTime);
+}
 
-    auto const parityBit = calculateParity(message.slave, 12);
-    m_driver.transmitBit(parityBit);
+auto Controller::forwardMessage(MessagePool::Handle message, Time const frameStartTime) -> void {
+  auto const isScheduled = m_forwardTarget->scheduleTransmit(std::move(message), m_forwardOptions);
+  if (not isScheduled) {
+    m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+    m_driver.getStatistics().countForwardDrop();
+    return;
+  }
 
-    auto const ackBit = m_driver.receiveAckBit();
-    if (ackBit == AcknowledgmentType::NAK) {
-      ESP_LOGE(TAG, "No ACK for address");
-      return false;
+  recordLatency(frameStartTime);
+}
+
+auto Controller::recordLatency(Time const frameStartTime) -> void {
+  m_driver.getStatistics().recordLatency(m_driver.getBusTime() - frameStartTime);
+}
+
+auto Controller::countDropped() -> void {
+  m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+  m_driver.getStatistics().countQueueOverflow();
+}
+
+auto Controller::findLocalDevice(Address const address) const -> LocalDevice const* {
+  if (not isLocalAddress(address)) {
+    return nullptr;
+  }
+
+  for (Size i = 0; i < m_localDeviceCount; ++i) {
+    if (m_localDevices[i].address == address) {
+      return &m_localDevices[i];
     }
   }
 
-  {
-    m_driver.transmitBits(message.control, 4);
+  return nullptr;
+}
 
-    auto const parityBit = calculateParity(message.control, 4);
-    m_driver.transmitBit(parityBit);
+auto Controller::requestTransmit(TransmitRequest request) -> std::optional<std::uint32_t> {
+  TransmitCompletion completion = {};
+  completion.semaphore          = xSemaphoreCreateBinaryStatic(&completion.storage);
 
-    auto const ackBit = m_driver.receiveAckBit();
-    if (ackBit == AcknowledgmentType::NAK) {
-      ESP_LOGE(TAG, "No ACK for control");
-      return false;
+  request.completion = &completion;
+  if (request.transfer != nullptr) {
+    request.transfer->completion = &completion;
+  }
+
+  auto isQueued = false;
+
+  // The lock is not held while the queue is full, the receiver task takes it to stop
+  while (true) {
+    xSemaphoreTake(m_transmitLock, portMAX_DELAY);
+    auto const isRunning = isReceiverRunning();
+    isQueued             = isRunning and xQueueSend(m_transmitQueue, &request, 0) == pdTRUE;
+    if (isQueued) {
+      wakeReceiver();
+    }
+    xSemaphoreGive(m_transmitLock);
+
+    if (isQueued or not isRunning) {
+      break;
+    }
+
+    vTaskDelay(TRANSMIT_RETRY_DELAY);
+  }
+
+  if (isQueued) {
+    xSemaphoreTake(completion.semaphore, portMAX_DELAY);
+  }
+
+  vSemaphoreDelete(completion.semaphore);
+
+  if (not isQueued) {
+    return std::nullopt;
+  }
+
+  return completion.result;
+}
+
+auto Controller::serveTransmitRequests() -> void {
+  TransmitRequest request = {};
+
+  if (m_activeTransfer != nullptr) {
+    auto const isPending = transmitSegments(*m_activeTransfer);
+    if (isPending) {
+      return;
     }
+
+    completeTransmitRequest(*m_activeTransfer->completion, m_activeTransfer->isFailed ? 0 : 1);
+    m_activeTransfer = nullptr;
   }
 
-  {
-    m_driver.transmitBits(message.dataLength, 8);
+  while (xQueueReceive(m_transmitQueue, &request, 0) == pdTRUE) {
+    if (request.transfer != nullptr) {
+      m_activeTransfer = request.transfer;
+      return;
+    }
 
-    auto const parityBit = calculateParity(message.dataLength, 8);
-    m_driver.transmitBit(parityBit);
+    if (request.message == nullptr) {
+      auto const result = transmitBatch(request.batch);
+      completeTransmitRequest(*request.completion, result);
+      continue;
+    }
 
-    auto const ackBit = m_driver.receiveAckBit();
-    if (ackBit == AcknowledgmentType::NAK) {
-      ESP_LOGE(TAG, "No ACK for data length");
+    auto const isTransmitted = transmitMessage(*request.message);
+    completeTransmitRequest(*request.completion, isTransmitted ? 1 : 0);
+  }
+}
+
+auto Controller::transmitSegments(SegmentedTransfer& transfer) -> bool {
+  for (Size i = 0; i < transfer.window and transfer.nextSegment < transfer.segmentCount; ++i) {
+    auto const index  = transfer.nextSegment;
+    auto const offset = index * SEGMENT_PAYLOAD_SIZE;
+    auto const size   = std::min<Size>(transfer.message.data.size() - offset, SEGMENT_PAYLOAD_SIZE);
+
+    std::array<Byte, SEGMENT_HEADER_SIZE> const header = {
+        static_cast<Byte>(index),
+        static_cast<Byte>(transfer.segmentCount - 1),
+    };
+
+    auto segment   = transfer.message;
+    segment.prefix = header;
+    segment.data   = transfer.message.data.subspan(offset, size);
+
+    auto isTransmitted = false;
+    for (Size attempt = 0; attempt <= SEGMENT_RETRY_COUNT and not isTransmitted; ++attempt) {
+      isTransmitted = transmitMessage(segment, index > 0);
+    }
+
+    if (not isTransmitted) {
+      transfer.isFailed = true;
       return false;
     }
+
+    transfer.nextSegment += 1;
   }
 
-  for (Size i = 0; i < message.dataLength; i++) {
-    m_driver.transmitBits(message.data[i], 8);
+  return transfer.nextSegment < transfer.segmentCount;
+}
+
+auto Controller::serveScheduledMessages() -> void {
+  m_transmitScheduler.expire(xTaskGetTickCount());
+
+  while (auto const index = m_transmitScheduler.next(xTaskGetTickCount())) {
+    auto const& message = m_transmitScheduler.getMessage(*index);
+    auto const length   = message.dataLength < message.data.size() ? message.dataLength : message.data.size();
+
+    MessageView const view = {
+        .broadcast = message.broadcast,
+        .master    = message.master,
+        .slave     = message.slave,
+        .control   = message.control,
+        .data      = std::span(message.data).first(length),
+    };
+
+    auto const isTransmitted = transmitMessage(view);
+    m_transmitScheduler.complete(*index, isTransmitted, xTaskGetTickCount());
+  }
+}
+
+auto Controller::rejectTransmitRequests() -> void {
+  TransmitRequest request = {};
+
+  if (m_activeTransfer != nullptr) {
+    completeTransmitRequest(*m_activeTransfer->completion, 0);
+    m_activeTransfer = nullptr;
+  }
+
+  while (xQueueReceive(m_transmitQueue, &request, 0) == pdTRUE) {
+    completeTransmitRequest(*request.completion, 0);
+  }
+}
+
+auto Controller::completeTransmitRequest(TransmitCompletion& completion, std::uint32_t const result) -> void {
+  completion.result = result;
+  xSemaphoreGive(completion.semaphore);
+}
+
+auto Controller::isForThisDevice(Message const& message) const -> bool {
+  return message.broadcast == BroadcastType::FOR_DEVICE and isLocalAddress(message.slave);
+}
+
+auto Controller::scheduleTransmit(MessagePool::Handle message, TransmitScheduler::Options const& options) -> bool {
+  // Under the lock the receiver is not stopped between the check and the push, the scheduler is cancelled after the stop.
+  // Nothing serves the scheduler of a stopped receiver, the message would hold its pool until it expires
+  xSemaphoreTake(m_transmitLock, portMAX_DELAY);
+  auto const isScheduled = isReceiverRunning() and m_transmitScheduler.push(std::move(message), options);
+  if (isScheduled) {
+    wakeReceiver();
+  }
+  xSemaphoreGive(m_transmitLock);
+
+  return isScheduled;
+}
+
+auto Controller::wakeReceiver() -> void {
+  // The shared task leaves the group only after detachReceiver() stopped the receiver under the lock
+  if (m_isReceiverAttached and not isReceiverTask()) {
+    xTaskNotifyGive(m_receiverTask);
+  }
+}
+
+auto Controller::isReceiverTask() const -> bool {
+  return m_receiverTask != nullptr and m_receiverTask == xTaskGetCurrentTaskHandle();
+}
+
+auto Controller::isDispatchTask() const -> bool {
+  return m_dispatchTask != nullptr and m_dispatchTask == xTaskGetCurrentTaskHandle();
+}
+
+auto Controller::isSlaveAcknowledged(Data const value, void* const context) -> bool {
+  auto const* const ackContext = static_cast<AckContext const*>(context);
+  return ackContext->message->broadcast == BroadcastType::FOR_DEVICE and ackContext->controller->isLocalAddress(static_cast<Address>(value));
+}
 
-    auto const parityBit = calculateParity(message.data[i], 8);
-    m_driver.transmitBit(parityBit);
+auto Controller::isFieldAcknowledged(Data const, void* const context) -> bool {
+  auto const* const ackContext = static_cast<AckContext const*>(context);
+  return ackContext->controller->isForThisDevice(*ackContext->message);
+}
+
+template <typename FieldType, typename T> auto Controller::receiveField(T& destination, Message const& message, FrameField const field, Size const index) -> bool {
+  AckContext ackContext = {
+      .controller = this,
+      .message    = &message,
+  };
+
+  auto const decision = field == FrameField::SLAVE_ADDRESS ? isSlaveAcknowledged : isFieldAcknowledged;
+  auto const data     = m_driver.receiveField<FieldType>(decision, &ackContext);
+  if (not data) {
+    m_diagnostics.record(DiagnosticError::FIELD_TIMEOUT, field, index);
+#ifdef CONFIG_IEBUS_DECODE_LOGGING
+    ESP_LOGW(TAG, "Field %u timeout", static_cast<unsigned>(field));
+#endif
+    return false;
+  }
 
-    auto const ackBit = m_driver.receiveAckBit();
-    if (ackBit == AcknowledgmentType::NAK) {
-      ESP_LOGE(TAG, "No ACK for data byte %u", i);
+  destination = static_cast<T>(data->data);
+
+  if constexpr (FieldType::HAS_ACK) {
+    auto const isNeedAnswer = data->acknowledgment == AcknowledgmentType::ACK;
+    auto const isAnswer     = isNeedAnswer and m_driver.getAckMode() == AckMode::DEFERRED and isForThisDevice(message);
+
+    if (isAnswer) {
+      m_driver.sendAckBit(data->isParityValid ? AcknowledgmentType::ACK : AcknowledgmentType::NAK);
+    }
+  }
+
+  if (not data->isParityValid) {
+    m_diagnostics.record(DiagnosticError::PARITY_ERROR, field, index);
+    m_driver.getStatistics().countParityError(field);
+#ifdef CONFIG_IEBUS_DECODE_LOGGING
+    ESP_LOGW(TAG, "Field %u parity error", static_cast<unsigned>(field));
+#endif
+    return false;
+  }
+
+  return true;
+}
+
+template <typename FieldType> auto Controller::captureField(Data& value) -> bool {
+  auto const data = m_driver.receiveField<FieldType>();
+  if (not data) {
+    return false;
+  }
+
+  value = data->data;
+
+  auto const isAcknowledged = FieldType::HAS_ACK and data->acknowledgment == AcknowledgmentType::ACK;
+  m_sniffer->addField(data->data, data->isParityValid, isAcknowledged);
+
+  return true;
+}
+
+auto Controller::captureFrame() -> void {
+  m_sniffer->beginRecord(m_driver.getFrameStartTime());
+
+  Data value      = 0;
+  Data dataLength = 0;
+
+  auto const isHeaderReceived = captureField<BroadcastField>(value) and captureField<MasterAddressField>(value) and captureField<SlaveAddressField>(value) and
+                                captureField<ControlField>(value) and captureField<DataLengthField>(dataLength);
+
+  if (isHeaderReceived) {
+    Size const dataSize = dataLength == 0 ? MAX_MESSAGE_SIZE : dataLength;
+
+    for (Size i = 0; i < dataSize; i++) {
+      if (not captureField<DataField>(value)) {
+        break;
+      }
+    }
+  }
+
+  m_sniffer->commitRecord();
+}
+
+auto Controller::captureTransmittedFrame(MessageView const& message, bool const isAcknowledged) -> void {
+  m_sniffer->beginRecord(m_driver.getFrameStartTime(), true);
+
+  m_sniffer->addField(static_cast<Data>(message.broadcast), true, false);
+  m_sniffer->addField(message.master, true, false);
+  m_sniffer->addField(message.slave, true, isAcknowledged);
+  m_sniffer->addField(message.control, true, isAcknowledged);
+  m_sniffer->addField(static_cast<Data>(message.prefix.size() + message.data.size()), true, isAcknowledged);
+
+  for (auto const byte : message.prefix) {
+    m_sniffer->addField(byte, true, isAcknowledged);
+  }
+
+  for (auto const byte : message.data) {
+    m_sniffer->addField(byte, true, isAcknowledged);
+  }
+
+  m_sniffer->commitRecord();
+}
+
+auto Controller::receiveMessage(Message& message, TickType_t const timeout) -> bool {
+  if (not m_driver.receiveStartBit(timeout)) {
+    return false;
+  }
+
+  return decodeMessage(message);
+}
+
+auto Controller::decodeMessage(Message& message) -> bool {
+  auto const isHeaderReceived = decodeHeader(message);
+  if (not isHeaderReceived) {
+    return false;
+  }
+
+  for (Size i = 0; i < message.dataLength; i++) {
+    auto const isReceived = receiveField<DataField>(message.data[i], message, FrameField::DATA, i);
+    if (not isReceived) {
       return false;
     }
   }
 
+  m_driver.getStatistics().countFrameReceived();
+
   return true;
 }
 
-auto Controller::checkParity(Driver::Data const data, Size const size, Bit const parity) -> bool {
-  auto const calculatedParity = calculateParity(data, size);
+auto Controller::decodeHeader(Message& message) -> bool {
+  auto const isAddressReceived = receiveField<BroadcastField>(message.broadcast, message, FrameField::BROADCAST) and
+                                 receiveField<MasterAddressField>(message.master, message, FrameField::MASTER_ADDRESS) and
+                                 receiveField<SlaveAddressField>(message.slave, message, FrameField::SLAVE_ADDRESS);
+  if (not isAddressReceived) {
+    return false;
+  }
 
-  auto const isValid = calculatedParity == parity;
-  if (not isValid) {
-    ESP_LOGE(TAG, "Parity error (%d != %d)", calculatedParity, parity);
+  auto const isAddressAccepted = isForThisDevice(message) or m_acceptanceFilter.acceptsAddress(message.master, message.slave);
+  if (not isAddressAccepted) {
+    m_driver.skipFrame();
     return false;
   }
 
+  auto const isControlReceived = receiveField<ControlField>(message.control, message, FrameField::CONTROL);
+  if (not isControlReceived) {
+    return false;
+  }
+
+  auto const isAccepted = isForThisDevice(message) or m_acceptanceFilter.accepts(message.master, message.slave, message.control);
+  if (not isAccepted) {
+    m_driver.skipFrame();
+    return false;
+  }
+
+  auto const isLengthReceived = receiveField<DataLengthField>(message.dataLength, message, FrameField::DATA_LENGTH);
+  if (not isLengthReceived) {
+    return false;
+  }
+
+  if (message.dataLength == 0) {
+    message.dataLength = MAX_MESSAGE_SIZE;
+  }
+
   return true;
 }
 
-auto Controller::calculateParity(Driver::Data const data, Size const size) -> Bit {
-  Bit parity = 0;
+auto Controller::transmitMessage(MessageView const& message, bool const isFollowing) -> bool {
+  encodeFrame(message, m_frame);
+
+  auto const busFreeTimeout = m_isReceiverAttached ? SHARED_BUS_FREE_TIMEOUT : portMAX_DELAY;
+  auto const isBusFree      = (isFollowing and m_driver.isBusFree()) or m_driver.waitBusFree(busFreeTimeout);
+  if (not isBusFree) {
+    ESP_LOGE(TAG, "Bus is not free");
+    return false;
+  }
+
+  auto const result = m_driver.transmitFrame(m_frame);
+
+  auto const isCaptured = m_sniffer != nullptr and isReceiverTask();
+  if (isCaptured and result != TransmitResult::ARBITRATION_LOST and result != TransmitResult::FAILED) {
+    captureTransmittedFrame(message, result == TransmitResult::ACKNOWLEDGED);
+  }
+
+  switch (result) {
+  case TransmitResult::ACKNOWLEDGED:
+    m_driver.getStatistics().countFrameSent();
+    return true;
+  case TransmitResult::NOT_ACKNOWLEDGED:
+    m_diagnostics.record(DiagnosticError::NO_ACK, FrameField::NONE);
+    m_driver.getStatistics().countNak();
+    ESP_LOGE(TAG, "No ACK for frame");
+    return false;
+  case TransmitResult::ARBITRATION_LOST:
+    m_diagnostics.record(DiagnosticError::ARBITRATION_LOST, FrameField::MASTER_ADDRESS);
+    m_driver.getStatistics().countArbitrationLost();
+    receiveArbitrationWinner();
+    return false;
+  case TransmitResult::COLLISION:
+    m_diagnostics.record(DiagnosticError::COLLISION, FrameField::NONE);
+    return false;
+  case TransmitResult::FAILED:
+    return false;
+  }
+
+  return false;
+}
+
+auto Controller::transmitBatch(std::span<Message const> const messages) -> BatchResult {
+  BatchResult result = 0;
+
+  for (Size i = 0; i < messages.size(); ++i) {
+    auto const& message = messages[i];
+    auto const length   = message.dataLength < message.data.size() ? message.dataLength : message.data.size();
+
+    MessageView const view = {
+        .broadcast = message.broadcast,
+        .master    = message.master,
+        .slave     = message.slave,
+        .control   = message.control,
+        .data      = std::span(message.data).first(length),
+    };
 
-  for (Size i = 0; i < size; i++) {
-    parity ^= data >> i & 1;
+    auto const isTransmitted = transmitMessage(view, i > 0);
+    if (isTransmitted) {
+      result |= BatchResult{1} << i;
+    }
   }
 
-  return parity;
+  return result;
+}
+
+auto Controller::receiveArbitrationWinner() -> void {
+  if (m_sniffer != nullptr and isReceiverTask()) {
+    return captureFrame();
+  }
+
+  if (isReceiverTask()) {
+    auto message = m_messagePool.acquire();
+    if (message) {
+      auto const isReceived = decodeMessage(*message);
+      if (isReceived) {
+        deliverMessage(std::move(message));
+      }
+
+      return;
+    }
+  }
+
+  Message discarded = {};
+
+  auto const isReceived = decodeMessage(discarded);
+  if (isReceived) {
+    countDropped();
+  }
+}
+
+auto Controller::encodeFrame(MessageView const& message, Frame& frame) -> void {
+  frame.clear();
+  frame.appendStartBit();
+
+  BroadcastField::encode(static_cast<Data>(message.broadcast), frame);
+  MasterAddressField::encode(message.master, frame);
+  SlaveAddressField::encode(message.slave, frame);
+  ControlField::encode(message.control, frame);
+  DataLengthField::encode(static_cast<Data>(message.prefix.size() + message.data.size()), frame);
+
+  for (auto const byte : message.prefix) {
+    DataField::encode(byte, frame);
+  }
+
+  for (auto const byte : message.data) {
+    DataField::encode(byte, frame);
+  }
 }
 
 } // namespace iebus
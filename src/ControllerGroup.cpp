@@ -0,0 +1,146 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/ControllerGroup.hpp"
+
+#include <esp_log.h>
+
+#include "common.hpp"
+
+namespace iebus {
+
+namespace {
+
+auto constexpr TAG = "IEBusControllerGroup";
+
+auto constexpr SERVICE_TASK_NAME  = "iebus_group";
+auto constexpr SERVICE_STACK_SIZE = 4096;
+
+} // namespace
+
+ControllerGroup::~ControllerGroup() {
+  stop();
+}
+
+auto ControllerGroup::isRunning() const -> bool {
+  return m_isRunning.load();
+}
+
+auto ControllerGroup::add(Controller& controller) -> bool {
+  if (isRunning()) {
+    ESP_LOGE(TAG, "Group is running");
+    return false;
+  }
+
+  if (m_controllerCount >= m_controllers.size()) {
+    ESP_LOGE(TAG, "Group is full");
+    return false;
+  }
+
+  m_controllers[m_controllerCount++] = &controller;
+  return true;
+}
+
+auto ControllerGroup::start(BaseType_t const core, UBaseType_t const priority, Size const capacity) -> bool {
+  if (isRunning()) {
+    return true;
+  }
+
+  if (not isSingleCoreAffinity(core)) {
+    ESP_LOGE(TAG, "Group task has to be pinned, bit timing uses the per core cycle counter");
+    return false;
+  }
+
+  m_isRunning = true;
+
+  auto const isCreated = xTaskCreatePinnedToCore(serviceTask, SERVICE_TASK_NAME, SERVICE_STACK_SIZE, this, priority, &m_task, core) == pdPASS;
+  if (not isCreated) {
+    ESP_LOGE(TAG, "Failed to create group task");
+    m_isRunning = false;
+    m_task      = nullptr;
+    return false;
+  }
+
+  for (Size i = 0; i < m_controllerCount; ++i) {
+    auto const isAttached = m_controllers[i]->attachReceiver(m_task, capacity);
+    if (not isAttached) {
+      stop();
+      return false;
+    }
+  }
+
+  xTaskNotifyGive(m_task);
+
+  return true;
+}
+
+auto ControllerGroup::stop() -> void {
+  if (m_task == nullptr) {
+    return;
+  }
+
+  m_stoppingTask = xTaskGetCurrentTaskHandle();
+  m_isRunning    = false;
+
+  xTaskNotifyGive(m_task);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+  m_task         = nullptr;
+  m_stoppingTask = nullptr;
+}
+
+auto ControllerGroup::serviceTask(void* const context) -> void {
+  auto* const group = static_cast<ControllerGroup*>(context);
+
+  // Controllers need the task handle before they are served, start() releases the task once all are attached
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+  while (group->isRunning()) {
+    auto isActive = false;
+
+    for (Size i = 0; i < group->m_controllerCount; ++i) {
+      isActive = group->m_controllers[i]->serviceReceiver(0) or isActive;
+    }
+
+    if (isActive) {
+      continue;
+    }
+
+    auto timeout = portMAX_DELAY;
+
+    for (Size i = 0; i < group->m_controllerCount; ++i) {
+      auto const waitTime = group->m_controllers[i]->prepareIdleWait(timeout);
+      timeout             = waitTime < timeout ? waitTime : timeout;
+    }
+
+    // A transmission may have taken the stop notification, the running flag is checked again after it
+    if (timeout > 0 and group->isRunning()) {
+      ulTaskNotifyTake(pdTRUE, timeout);
+    }
+  }
+
+  // Detached by the task itself, so controllers never notify it once it is deleted
+  for (Size i = 0; i < group->m_controllerCount; ++i) {
+    group->m_controllers[i]->detachReceiver();
+  }
+
+  xTaskNotifyGive(group->m_stoppingTask);
+  vTaskDelete(nullptr);
+}
+
+} // namespace iebus
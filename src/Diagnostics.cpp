@@ -0,0 +1,175 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/Diagnostics.hpp"
+
+#include <esp_log.h>
+
+#include "common.hpp"
+
+namespace iebus {
+
+namespace {
+
+auto constexpr TAG = "IEBusDiagnostics";
+
+auto constexpr LOGGER_TASK_NAME  = "iebus_logger";
+auto constexpr LOGGER_STACK_SIZE = 3072;
+auto constexpr LOGGER_PERIOD_MS  = 100;
+
+auto formatError(DiagnosticError const error) -> char const* {
+  switch (error) {
+  case DiagnosticError::FIELD_TIMEOUT:
+    return "timeout";
+  case DiagnosticError::PARITY_ERROR:
+    return "parity error";
+  case DiagnosticError::NO_ACK:
+    return "no ACK";
+  case DiagnosticError::ARBITRATION_LOST:
+    return "arbitration lost";
+  case DiagnosticError::COLLISION:
+    return "collision";
+  }
+
+  return "unknown error";
+}
+
+auto formatField(FrameField const field) -> char const* {
+  switch (field) {
+  case FrameField::NONE:
+    return "Frame";
+  case FrameField::BROADCAST:
+    return "Broadcast bit";
+  case FrameField::MASTER_ADDRESS:
+    return "Master address";
+  case FrameField::SLAVE_ADDRESS:
+    return "Slave address";
+  case FrameField::CONTROL:
+    return "Control";
+  case FrameField::DATA_LENGTH:
+    return "Length";
+  case FrameField::DATA:
+    return "Data byte";
+  }
+
+  return "Unknown field";
+}
+
+} // namespace
+
+Diagnostics::~Diagnostics() {
+  stopLogger();
+}
+
+auto Diagnostics::getCount(DiagnosticError const error) const -> std::uint32_t {
+  return m_counts[static_cast<Size>(error)].load(std::memory_order_relaxed);
+}
+
+auto Diagnostics::getLostCount() const -> std::uint32_t {
+  return m_lostCount.load(std::memory_order_relaxed);
+}
+
+auto Diagnostics::isLoggerRunning() const -> bool {
+  return m_isLoggerRunning.load();
+}
+
+auto Diagnostics::record(DiagnosticError const error, FrameField const field, Size const index) -> void {
+  m_counts[static_cast<Size>(error)].fetch_add(1, std::memory_order_relaxed);
+
+  Event const event = {
+      .timestamp = getTimeUS(),
+      .error     = error,
+      .field     = field,
+      .index     = static_cast<std::uint16_t>(index),
+  };
+
+  auto const isPushed = m_events.push(event);
+  if (not isPushed) {
+    m_lostCount.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+auto Diagnostics::takeEvent() -> std::optional<Event> {
+  return m_events.pop();
+}
+
+auto Diagnostics::logEvents() -> void {
+  while (auto const event = takeEvent()) {
+    if (event->field == FrameField::DATA) {
+      ESP_LOGW(TAG, "%s %u %s at %lld us", formatField(event->field), event->index, formatError(event->error), event->timestamp);
+    } else {
+      ESP_LOGW(TAG, "%s %s at %lld us", formatField(event->field), formatError(event->error), event->timestamp);
+    }
+  }
+}
+
+auto Diagnostics::resetCounters() -> void {
+  for (auto& count : m_counts) {
+    count = 0;
+  }
+
+  m_lostCount = 0;
+}
+
+auto Diagnostics::startLogger(UBaseType_t const priority) -> bool {
+  if (isLoggerRunning()) {
+    return true;
+  }
+
+  m_isLoggerRunning = true;
+
+  auto const isCreated = xTaskCreate(loggerTask, LOGGER_TASK_NAME, LOGGER_STACK_SIZE, this, priority, &m_loggerTask) == pdPASS;
+  if (not isCreated) {
+    ESP_LOGE(TAG, "Failed to create logger task");
+    m_isLoggerRunning = false;
+    m_loggerTask      = nullptr;
+    return false;
+  }
+
+  return true;
+}
+
+auto Diagnostics::stopLogger() -> void {
+  if (m_loggerTask == nullptr) {
+    return;
+  }
+
+  m_stoppingTask    = xTaskGetCurrentTaskHandle();
+  m_isLoggerRunning = false;
+
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+  m_loggerTask   = nullptr;
+  m_stoppingTask = nullptr;
+}
+
+auto Diagnostics::loggerTask(void* const context) -> void {
+  auto* const diagnostics = static_cast<Diagnostics*>(context);
+
+  while (diagnostics->isLoggerRunning()) {
+    diagnostics->logEvents();
+    vTaskDelay(pdMS_TO_TICKS(LOGGER_PERIOD_MS));
+  }
+
+  diagnostics->logEvents();
+
+  xTaskNotifyGive(diagnostics->m_stoppingTask);
+  vTaskDelete(nullptr);
+}
+
+} // namespace iebus
@@ -0,0 +1,167 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#include "iebus/Dispatcher.hpp"
+
+#include <algorithm>
+
+namespace iebus {
+
+namespace {
+
+auto constexpr ADDRESS_MASK = 0x0FFF;
+auto constexpr CONTROL_MASK = 0x0F;
+
+auto constexpr MASTER_SHIFT = 16;
+auto constexpr SLAVE_SHIFT  = 4;
+
+} // namespace
+
+auto Dispatcher::isBuilt() const -> bool {
+  return m_isBuilt;
+}
+
+auto Dispatcher::getSubscriptionCount() const -> Size {
+  return m_subscriptionCount;
+}
+
+auto Dispatcher::subscribe(Address const master, Address const slave, Byte const control, Handler const handler, void* const context) -> bool {
+  if (m_isBuilt or m_subscriptionCount >= m_subscriptions.size() or handler == nullptr) {
+    return false;
+  }
+
+  std::uint8_t pattern = 0;
+  if (master == ANY_ADDRESS) {
+    pattern |= ANY_MASTER_BIT;
+  }
+  if (slave == ANY_ADDRESS) {
+    pattern |= ANY_SLAVE_BIT;
+  }
+  if (control == ANY_CONTROL) {
+    pattern |= ANY_CONTROL_BIT;
+  }
+
+  m_subscriptions[m_subscriptionCount++] = {
+      .key     = maskKey(makeKey(master, slave, control), pattern),
+      .handler = handler,
+      .context = context,
+      .pattern = pattern,
+  };
+
+  return true;
+}
+
+auto Dispatcher::build() -> void {
+  if (m_isBuilt) {
+    return;
+  }
+
+  auto const isBefore = [](Subscription const& left, Subscription const& right) {
+    return left.pattern < right.pattern or (left.pattern == right.pattern and left.key < right.key);
+  };
+
+  // Insertion sort keeps the subscription order of equal keys without a temporary buffer
+  for (Size i = 1; i < m_subscriptionCount; ++i) {
+    auto const subscription = m_subscriptions[i];
+
+    auto j = i;
+    while (j > 0 and isBefore(subscription, m_subscriptions[j - 1])) {
+      m_subscriptions[j] = m_subscriptions[j - 1];
+      j--;
+    }
+
+    m_subscriptions[j] = subscription;
+  }
+
+  m_patternMask = 0;
+
+  Size index = 0;
+  for (Size pattern = 0; pattern < PATTERN_COUNT; ++pattern) {
+    m_patternBegin[pattern] = static_cast<std::uint8_t>(index);
+
+    while (index < m_subscriptionCount and m_subscriptions[index].pattern == pattern) {
+      m_patternMask |= static_cast<std::uint8_t>(1U << pattern);
+      index++;
+    }
+  }
+
+  m_patternBegin[PATTERN_COUNT] = static_cast<std::uint8_t>(index);
+  m_isBuilt                     = true;
+}
+
+auto Dispatcher::dispatch(Message const& message) const -> Size {
+  if (not m_isBuilt) {
+    return 0;
+  }
+
+  auto const key = makeKey(message.master, message.slave, message.control);
+
+  Size count = 0;
+
+  for (std::uint8_t pattern = 0; pattern < PATTERN_COUNT; ++pattern) {
+    if ((m_patternMask & (1U << pattern)) == 0) {
+      continue;
+    }
+
+    auto const maskedKey = maskKey(key, pattern);
+
+    auto const* const begin = m_subscriptions.data() + m_patternBegin[pattern];
+    auto const* const end   = m_subscriptions.data() + m_patternBegin[pattern + 1];
+
+    auto const* subscription = std::lower_bound(begin, end, maskedKey, [](Subscription const& entry, std::uint32_t const value) { return entry.key < value; });
+
+    for (; subscription != end and subscription->key == maskedKey; ++subscription) {
+      subscription->handler(message, subscription->context);
+      count++;
+    }
+  }
+
+  return count;
+}
+
+auto Dispatcher::dispatch(Controller& controller, TickType_t const timeout) const -> bool {
+  auto const message = controller.read(timeout);
+  if (not message) {
+    return false;
+  }
+
+  dispatch(*message);
+
+  return true;
+}
+
+auto Dispatcher::makeKey(Address const master, Address const slave, Byte const control) -> std::uint32_t {
+  return static_cast<std::uint32_t>(master & ADDRESS_MASK) << MASTER_SHIFT | static_cast<std::uint32_t>(slave & ADDRESS_MASK) << SLAVE_SHIFT | (control & CONTROL_MASK);
+}
+
+auto Dispatcher::maskKey(std::uint32_t const key, std::uint8_t const pattern) -> std::uint32_t {
+  auto mask = std::uint32_t{0xFFFF'FFFF};
+
+  if (pattern & ANY_MASTER_BIT) {
+    mask &= ~(static_cast<std::uint32_t>(ADDRESS_MASK) << MASTER_SHIFT);
+  }
+  if (pattern & ANY_SLAVE_BIT) {
+    mask &= ~(static_cast<std::uint32_t>(ADDRESS_MASK) << SLAVE_SHIFT);
+  }
+  if (pattern & ANY_CONTROL_BIT) {
+    mask &= ~static_cast<std::uint32_t>(CONTROL_MASK);
+  }
+
+  return key & mask;
+}
+
+} // namespace iebus
@@ -18,13 +18,21 @@
 
 #include "iebus/Driver.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+
 #include <driver/gpio.h>
+#include <esp_attr.h>
 #include <esp_log.h>
+#include <esp_sleep.h>
 #include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <hal/gpio_ll.h>
+#include <soc/gpio_struct.h>
 
 #include "common.hpp"
+#include "protocol.hpp"
 
 namespace iebus {
 
@@ -32,31 +40,52 @@ namespace {
 
 auto constexpr TAG = "IEBusDriver";
 
-auto constexpr START_BIT_TOTAL_US     = 190;
-auto constexpr START_BIT_HIGH_US      = 171;
-auto constexpr START_BIT_LOW_US       = START_BIT_TOTAL_US - START_BIT_HIGH_US;
-auto constexpr START_BIT_THRESHOLD_US = 20;
+auto constexpr ECHO_TIMEOUT_MS = 20;
+
+/**
+ * Longest wait for an edge inside a frame
+ */
+auto constexpr EDGE_TIMEOUT_US = DATA_BIT_TOTAL_US * 4;
+
+/**
+ * Longest wait of the reading task for a captured pulse inside a frame
+ */
+auto constexpr PULSE_TIMEOUT_MS = 2;
+auto constexpr PULSE_TIMEOUT    = pdMS_TO_TICKS(PULSE_TIMEOUT_MS) > 0 ? pdMS_TO_TICKS(PULSE_TIMEOUT_MS) : 1;
 
-auto constexpr DATA_BIT_TOTAL_US  = 39;
-auto constexpr DATA_BIT_0_HIGH_US = 33;
-auto constexpr DATA_BIT_0_LOW_US  = DATA_BIT_TOTAL_US - DATA_BIT_0_HIGH_US;
-auto constexpr DATA_BIT_1_HIGH_US = 20;
-auto constexpr DATA_BIT_1_LOW_US  = DATA_BIT_TOTAL_US - DATA_BIT_1_HIGH_US;
+/**
+ * Quiet bus time after the last frame before the power locks are released in low power listen mode
+ */
+auto constexpr LISTEN_HOLD_TIMEOUT_MS = 100;
+auto constexpr LISTEN_HOLD_TIMEOUT    = pdMS_TO_TICKS(LISTEN_HOLD_TIMEOUT_MS) > 0 ? pdMS_TO_TICKS(LISTEN_HOLD_TIMEOUT_MS) : 1;
 
-auto decodeBit(auto const pulseWidthUs) -> Bit {
-  auto const diff0 = std::abs(pulseWidthUs - DATA_BIT_0_HIGH_US);
-  auto const diff1 = std::abs(pulseWidthUs - DATA_BIT_1_HIGH_US);
+auto isStartBitWidth(auto const pulseWidthUs) -> bool {
+  return pulseWidthUs >= START_BIT_MIN_HIGH_US and pulseWidthUs <= START_BIT_MAX_HIGH_US;
+}
 
-  if (diff1 < diff0) {
-    return 1;
+/**
+ * Backend receive timeout of a wait in ticks
+ */
+auto toTimeoutUS(TickType_t const timeout) -> Time {
+  if (timeout == portMAX_DELAY) {
+    return Backend::WAIT_FOREVER;
   }
 
-  return 0;
+  return static_cast<Time>(timeout) * portTICK_PERIOD_MS * 1000;
+}
+
+/**
+ * RX pin interrupt outside of the bus free wait, rising edges wake the polling receiver
+ */
+auto getEdgeInterruptType(ReceiveMode const receiveMode) -> gpio_int_type_t {
+  return receiveMode == ReceiveMode::POLLING ? GPIO_INTR_POSEDGE : GPIO_INTR_DISABLE;
 }
 
 } // namespace
 
-Driver::Driver(Driver::Pin const rx, Driver::Pin const tx, Driver::Pin const enable) noexcept : m_rxPin(rx), m_txPin(tx), m_enablePin(enable) {
+Driver::Driver(Driver::Pin const rx, Driver::Pin const tx, Driver::Pin const enable, ReceiveMode const receiveMode, TransmitMode const transmitMode) noexcept
+    : m_rxPin(rx), m_txPin(tx), m_enablePin(enable), m_receiveMode(receiveMode), m_transmitMode(transmitMode), m_rmtReceiver(rx), m_edgeCapture(rx), m_idleDetector(rx),
+      m_rmtTransmitter(tx) {
 
   gpio_config_t const receiverConfiguration = {
       .pin_bit_mask = (1ULL << m_rxPin),
@@ -84,13 +113,60 @@ Driver::Driver(Driver::Pin const rx, Driver::Pin const tx, Driver::Pin const ena
       .intr_type    = GPIO_INTR_DISABLE,
   };
   gpio_config(&enableConfiguration);
+
+  m_edgeCapture.setEdgeHandler(onCapturedEdge, this);
+}
+
+Driver::Driver(Backend& backend) noexcept
+    : m_rxPin(0), m_txPin(0), m_enablePin(0), m_receiveMode(ReceiveMode::BACKEND), m_transmitMode(TransmitMode::BACKEND), m_backend(&backend), m_rmtReceiver(0),
+      m_edgeCapture(0), m_idleDetector(0), m_rmtTransmitter(0) {
 }
 
 auto Driver::isEnabled() const -> bool {
   return m_isEnabled;
 }
 
+auto Driver::getReceiveMode() const -> ReceiveMode {
+  return m_receiveMode;
+}
+
+auto Driver::getTransmitMode() const -> TransmitMode {
+  return m_transmitMode;
+}
+
+auto Driver::isAdaptiveTiming() const -> bool {
+  return m_bitTiming.isAdaptive();
+}
+
+auto Driver::getAckMode() const -> AckMode {
+  return m_ackMode;
+}
+
+auto Driver::isLowPowerListen() const -> bool {
+  return m_isLowPowerListen;
+}
+
+auto Driver::getBitTiming() const -> BitTiming::Timing {
+  return m_bitTiming.getTiming();
+}
+
+auto Driver::getFrameStartTime() const -> Time {
+  return m_frameStartTime;
+}
+
+auto Driver::getBusTime() const -> Time {
+  if (m_backend != nullptr) {
+    return m_backend->getTime();
+  }
+
+  return getTimeUS();
+}
+
 auto Driver::isBusHigh() const -> bool {
+  if (m_backend != nullptr) {
+    return not m_backend->isBusFree();
+  }
+
   return gpio_get_level(static_cast<gpio_num_t>(m_rxPin));
 }
 
@@ -99,16 +175,19 @@ auto Driver::isBusLow() const -> bool {
 }
 
 auto Driver::isBusFree() const -> bool {
+  if (m_backend != nullptr) {
+    return m_backend->isBusFree();
+  }
+
   if (isBusHigh()) {
     return false;
   }
 
-  auto const startTime = getTimeUS();
+  auto const startCycles    = getCycles();
+  auto const durationCycles = toCycles(DATA_BIT_TOTAL_US);
 
   while (isBusLow()) {
-    auto const currentTime    = getTimeUS();
-    auto const timeDifference = currentTime - startTime;
-    if (timeDifference >= DATA_BIT_TOTAL_US) {
+    if (isElapsed(startCycles, durationCycles)) {
       return true;
     }
   }
@@ -116,7 +195,130 @@ auto Driver::isBusFree() const -> bool {
   return false;
 }
 
+auto Driver::getStatistics() -> Statistics& {
+  return m_statistics;
+}
+
+auto Driver::setAdaptiveTiming(bool const isAdaptive) -> void {
+  m_bitTiming.setAdaptive(isAdaptive);
+
+  applyBitTiming();
+}
+
+auto Driver::setAckMode(AckMode const ackMode) -> bool {
+  auto const isSupported = m_receiveMode == ReceiveMode::POLLING and m_transmitMode == TransmitMode::BIT_BANG;
+  if (ackMode == AckMode::SCHEDULED and not isSupported) {
+    ESP_LOGE(TAG, "Scheduled acknowledgment needs polling receive and bit-bang transmit modes");
+    return false;
+  }
+
+  m_ackMode = ackMode;
+  return true;
+}
+
+auto Driver::setLowPowerListen(bool const isLowPowerListen) -> bool {
+  if (not isLowPowerListen) {
+    m_isLowPowerListen = false;
+    m_powerLock.destroy();
+    return true;
+  }
+
+  if (m_receiveMode != ReceiveMode::POLLING) {
+    ESP_LOGE(TAG, "Low power listen needs polling receive mode");
+    return false;
+  }
+
+  auto const isCreated = m_powerLock.create();
+  if (not isCreated) {
+    ESP_LOGE(TAG, "Low power listen needs power management");
+    return false;
+  }
+
+  auto const result = esp_sleep_enable_gpio_wakeup();
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to enable GPIO wakeup: %s", esp_err_to_name(result));
+    m_powerLock.destroy();
+    return false;
+  }
+
+  m_isLowPowerListen = true;
+  m_activityTick     = xTaskGetTickCount();
+
+  if (m_isEnabled) {
+    m_powerLock.acquire();
+  }
+
+  return true;
+}
+
 auto Driver::enable() -> void {
+  calibrateTimebase();
+
+  if (m_backend != nullptr) {
+    m_isEnabled = m_backend->enable();
+    if (not m_isEnabled) {
+      ESP_LOGE(TAG, "Backend is unavailable");
+      return;
+    }
+
+    m_powerLock.acquire();
+    return;
+  }
+
+  if (m_transmitMode == TransmitMode::RMT and m_receiveMode == ReceiveMode::POLLING) {
+    ESP_LOGE(TAG, "RMT transmit needs a capture receive mode to observe acknowledgments");
+    return;
+  }
+
+  if (m_receiveMode == ReceiveMode::RMT) {
+    auto const isReceiverEnabled = m_rmtReceiver.enable();
+    if (not isReceiverEnabled) {
+      ESP_LOGE(TAG, "RMT receiver is unavailable");
+      return;
+    }
+  }
+
+  if (m_receiveMode == ReceiveMode::INTERRUPT) {
+    auto const isCaptureEnabled = m_edgeCapture.enable();
+    if (not isCaptureEnabled) {
+      ESP_LOGE(TAG, "Edge capture is unavailable");
+      return;
+    }
+  }
+
+  if (m_transmitMode == TransmitMode::RMT) {
+    auto const isTransmitterEnabled = m_rmtTransmitter.enable();
+    if (not isTransmitterEnabled) {
+      ESP_LOGE(TAG, "RMT transmitter is unavailable");
+      m_rmtReceiver.disable();
+      m_edgeCapture.disable();
+      return;
+    }
+  }
+
+  if (m_receiveMode != ReceiveMode::INTERRUPT) {
+    auto const rxPin = static_cast<gpio_num_t>(m_rxPin);
+
+    auto const result = gpio_install_isr_service(0);
+    if (result != ESP_OK and result != ESP_ERR_INVALID_STATE) {
+      ESP_LOGE(TAG, "Failed to install GPIO ISR service: %s", esp_err_to_name(result));
+      m_rmtReceiver.disable();
+      m_rmtTransmitter.disable();
+      return;
+    }
+
+    gpio_set_intr_type(rxPin, getEdgeInterruptType(m_receiveMode));
+    gpio_isr_handler_add(rxPin, onEdge, this);
+    gpio_intr_disable(rxPin);
+  }
+
+  auto const isDetectorEnabled = m_idleDetector.enable();
+  if (not isDetectorEnabled) {
+    ESP_LOGW(TAG, "Idle detector is unavailable, bus free is polled");
+  }
+
+  m_powerLock.acquire();
+
   m_isEnabled = true;
 
   gpio_set_level(static_cast<gpio_num_t>(m_enablePin), m_isEnabled);
@@ -125,46 +327,173 @@ auto Driver::enable() -> void {
 auto Driver::disable() -> void {
   m_isEnabled = false;
 
-  gpio_set_level(static_cast<gpio_num_t>(m_enablePin), m_isEnabled);
+  if (m_backend != nullptr) {
+    m_backend->disable();
+  } else {
+    gpio_set_level(static_cast<gpio_num_t>(m_enablePin), m_isEnabled);
+  }
+
+  if (m_receiveMode != ReceiveMode::INTERRUPT and m_receiveMode != ReceiveMode::BACKEND) {
+    gpio_isr_handler_remove(static_cast<gpio_num_t>(m_rxPin));
+  }
+
+  m_idleDetector.disable();
+  m_powerLock.release();
+
+  m_capture         = std::nullopt;
+  m_isFrameCaptured = false;
+  m_pendingPulse    = std::nullopt;
+  m_riseTime        = std::nullopt;
+  m_edgeIndex       = 0;
+  m_edgeCount       = 0;
+  m_replayIndex     = 0;
+  m_replayCount     = 0;
+  m_rmtReceiver.disable();
+  m_rmtTransmitter.disable();
+  m_edgeCapture.disable();
 }
 
-auto Driver::receiveStartBit() -> bool {
-  auto constexpr startBitMinHighUs = START_BIT_HIGH_US - START_BIT_THRESHOLD_US;
-  auto constexpr startBitMaxHighUs = START_BIT_HIGH_US + START_BIT_THRESHOLD_US;
+auto Driver::waitBusFree(TickType_t const timeout) -> bool {
+  if (not m_isEnabled) {
+    return false;
+  }
 
-  waitBusHigh();
+  if (m_backend != nullptr or not m_idleDetector.isEnabled()) {
+    return pollBusFree(timeout);
+  }
 
-  auto const startTime = getTimeUS();
+  auto const rxPin        = static_cast<gpio_num_t>(m_rxPin);
+  auto const isOwnHandler = m_receiveMode != ReceiveMode::INTERRUPT;
 
-  waitBusLow();
+  if (isOwnHandler) {
+    gpio_set_intr_type(rxPin, GPIO_INTR_ANYEDGE);
+    gpio_intr_enable(rxPin);
+  }
+
+  m_idleDetector.start();
+
+  auto const isFree = m_idleDetector.wait(timeout);
 
-  auto const stopTime     = getTimeUS();
-  auto const highDuration = stopTime - startTime;
-  auto const isStartBit   = highDuration >= startBitMinHighUs and highDuration <= startBitMaxHighUs;
+  m_idleDetector.stop();
+
+  if (isOwnHandler) {
+    gpio_intr_disable(rxPin);
+    gpio_set_intr_type(rxPin, getEdgeInterruptType(m_receiveMode));
+  }
 
-  return isStartBit;
+  return isFree;
 }
 
-auto Driver::receiveBit() -> Bit {
-  waitBusHigh();
+auto Driver::armWakeup(TaskHandle_t const task) -> bool {
+  if (not m_isEnabled) {
+    return true;
+  }
+
+  auto const isCapturePending = m_capture and m_captureIndex < m_capture->symbols.size();
+  auto const isEdgePending    = m_edgeIndex < m_edgeCount;
+
+  if (m_pendingPulse or m_replayIndex < m_replayCount or isCapturePending or isEdgePending) {
+    return false;
+  }
+
+  if (m_receiveMode == ReceiveMode::RMT) {
+    return m_rmtReceiver.armWakeup(task);
+  }
+
+  if (m_receiveMode == ReceiveMode::INTERRUPT) {
+    return m_edgeCapture.armWakeup(task);
+  }
+
+  return false;
+}
 
-  auto const startTime = getTimeUS();
+auto Driver::receiveStartBit(TickType_t const timeout) -> bool {
+  m_replayIndex = 0;
+  m_replayCount = 0;
 
-  waitBusLow();
+  if (m_bitTiming.update()) {
+    applyBitTiming();
+  }
+
+  if (m_receiveMode != ReceiveMode::POLLING) {
+    return receiveCapturedStartBit(timeout);
+  }
+
+  auto const startTime = waitRisingEdge(timeout);
+  if (not startTime) {
+    return false;
+  }
 
-  auto const stopTime     = getTimeUS();
-  auto const highDuration = stopTime - startTime;
-  auto const bit          = decodeBit(highDuration);
+  auto const isWakeupEdge = std::exchange(m_isWakeupEdge, false);
+
+  auto const isBusLow = waitBusLow(*startTime + START_BIT_MAX_HIGH_US + EDGE_TIMEOUT_US - getTimeUS());
+
+  auto const highDuration = getTimeUS() - *startTime;
+  auto const isStartBit   = isBusLow and isStartBitWidth(highDuration);
+  if (not isStartBit and isWakeupEdge) {
+    // The woken chip came up too late to time the start bit. Stay awake for the repeat of the frame
+    m_statistics.countWakeupMiss();
+    m_activityTick = xTaskGetTickCount();
+    return false;
+  }
+
+  if (not isStartBit) {
+    m_statistics.countStartBitReject();
+    return false;
+  }
+
+  m_frameStartTime = *startTime;
+  m_activityTick   = xTaskGetTickCount();
+
+  return true;
+}
+
+auto Driver::receiveBit() -> std::optional<Bit> {
+  if (m_replayIndex < m_replayCount) {
+    return m_replayBits[m_replayIndex++];
+  }
+
+  if (m_isFrameCaptured) {
+    auto const pulse = receiveFramePulse();
+    if (not pulse) {
+      return std::nullopt;
+    }
+
+    m_statistics.recordHighTime(pulse->highTime);
+
+    return m_bitTiming.decode(pulse->highTime);
+  }
+
+  auto const isBusHigh = waitBusHigh(EDGE_TIMEOUT_US);
+  if (not isBusHigh) {
+    return std::nullopt;
+  }
+
+  auto const startCycles = getCycles();
+
+  auto const isBusLow = waitBusLow(EDGE_TIMEOUT_US);
+  if (not isBusLow) {
+    return std::nullopt;
+  }
+
+  auto const highDuration = toTimeUS(getCycles() - startCycles);
+  auto const bit          = m_bitTiming.decode(highDuration);
+
+  m_statistics.recordHighTime(highDuration);
 
   return bit;
 }
 
-auto Driver::receiveBits(Size const numBits) -> Data {
+auto Driver::receiveBits(Size const numBits) -> std::optional<Data> {
   Data result = 0;
 
   for (Size i = 0; i < numBits; ++i) {
-    auto const bit      = receiveBit();
-    auto const bitValue = bit ? 1 : 0;
+    auto const bit = receiveBit();
+    if (not bit) {
+      return std::nullopt;
+    }
+
+    auto const bitValue = *bit ? 1 : 0;
     auto const bitShift = numBits - 1 - i;
 
     result |= bitValue << bitShift;
@@ -173,16 +502,99 @@ auto Driver::receiveBits(Size const numBits) -> Data {
   return result;
 }
 
-auto Driver::receiveAckBit() -> AcknowledgmentType {
+auto Driver::receiveFieldBit(Data& data, Bit& parity) -> bool {
+  auto const bit = receiveBit();
+  if (not bit) {
+    return false;
+  }
+
+  data = static_cast<Data>((data << 1) | *bit);
+  parity ^= *bit;
+
+  return true;
+}
+
+auto Driver::receiveAckBit() -> std::optional<AcknowledgmentType> {
   auto const ackBit = receiveBit();
-  if (ackBit == 0) {
+  if (not ackBit) {
+    return std::nullopt;
+  }
+
+  if (*ackBit == 0) {
     return AcknowledgmentType::ACK;
   }
 
   return AcknowledgmentType::NAK;
 }
 
-auto Driver::transmitStartBit() const -> void {
+auto Driver::driveAckBit() -> std::optional<AcknowledgmentType> {
+  auto const holdCycles    = toCycles(m_bitTiming.getTiming().bit0HighUS);
+  auto const timeoutCycles = toCycles(EDGE_TIMEOUT_US);
+
+  auto const highCycles = driveAckSlot(holdCycles, timeoutCycles);
+  if (highCycles == 0) {
+    return std::nullopt;
+  }
+
+  m_statistics.recordHighTime(toTimeUS(highCycles));
+
+  return AcknowledgmentType::ACK;
+}
+
+auto IRAM_ATTR Driver::driveAckSlot(std::uint32_t const holdCycles, std::uint32_t const timeoutCycles) const -> std::uint32_t {
+  auto const rxPin = static_cast<std::uint32_t>(m_rxPin);
+  auto const txPin = static_cast<std::uint32_t>(m_txPin);
+
+  auto const waitCycles = getCycles();
+
+  while (gpio_ll_get_level(&GPIO, rxPin) == 0) {
+    if (isElapsed(waitCycles, timeoutCycles)) {
+      return 0;
+    }
+  }
+
+  // Master has started the slot, stretch its high phase into a 0 bit
+  gpio_ll_set_level(&GPIO, txPin, 1);
+
+  auto const startCycles = getCycles();
+
+  while (not isElapsed(startCycles, holdCycles)) {
+  }
+
+  gpio_ll_set_level(&GPIO, txPin, 0);
+
+  while (gpio_ll_get_level(&GPIO, rxPin) != 0) {
+    if (isElapsed(startCycles, holdCycles + timeoutCycles)) {
+      return 0;
+    }
+  }
+
+  return getCycles() - startCycles;
+}
+
+auto Driver::skipFrame() -> void {
+  if (m_receiveMode != ReceiveMode::POLLING) {
+    m_isFrameCaptured = false;
+    return;
+  }
+
+  while (waitBusHigh(EDGE_TIMEOUT_US)) {
+    auto const isBusLow = waitBusLow(EDGE_TIMEOUT_US);
+    if (not isBusLow) {
+      return;
+    }
+  }
+}
+
+auto Driver::transmitStartBit() -> void {
+  m_isFrameCaptured   = false;
+  m_transmitStartTime = getBusTime();
+  m_frameStartTime    = *m_transmitStartTime;
+
+  if (m_transmitMode != TransmitMode::BIT_BANG) {
+    return transmitSymbol(Symbol::START_BIT);
+  }
+
   gpio_set_level(static_cast<gpio_num_t>(m_txPin), 1);
   delayUS(START_BIT_HIGH_US);
 
@@ -190,9 +602,14 @@ auto Driver::transmitStartBit() const -> void {
   delayUS(START_BIT_LOW_US);
 }
 
-auto Driver::transmitBit(Bit const bit) const -> void {
-  auto const highDuration = bit ? DATA_BIT_1_HIGH_US : DATA_BIT_0_HIGH_US;
-  auto const lowDuration  = bit ? DATA_BIT_1_LOW_US : DATA_BIT_0_LOW_US;
+auto Driver::transmitBit(Bit const bit) -> void {
+  if (m_transmitMode != TransmitMode::BIT_BANG) {
+    return transmitSymbol(bit ? Symbol::BIT_1 : Symbol::BIT_0);
+  }
+
+  auto const timing       = m_bitTiming.getTiming();
+  auto const highDuration = bit ? timing.bit1HighUS : timing.bit0HighUS;
+  auto const lowDuration  = DATA_BIT_TOTAL_US - highDuration;
 
   gpio_set_level(static_cast<gpio_num_t>(m_txPin), 1);
   delayUS(highDuration);
@@ -201,7 +618,7 @@ auto Driver::transmitBit(Bit const bit) const -> void {
   delayUS(lowDuration);
 }
 
-auto Driver::transmitBits(Driver::Data const data, Size const numBits) const -> void {
+auto Driver::transmitBits(Driver::Data const data, Size const numBits) -> void {
   for (Size i = 0; i < numBits; ++i) {
     auto const bitPosition = numBits - 1 - i;
     auto const bit         = static_cast<Bit>(data >> bitPosition & 1);
@@ -210,7 +627,11 @@ auto Driver::transmitBits(Driver::Data const data, Size const numBits) const ->
   }
 }
 
-auto Driver::sendAckBit(AcknowledgmentType const ack) const -> void {
+auto Driver::sendAckBit(AcknowledgmentType const ack) -> void {
+  if (m_isFrameCaptured) {
+    return;
+  }
+
   if (ack == AcknowledgmentType::ACK) {
     return transmitBit(0);
   }
@@ -218,16 +639,480 @@ auto Driver::sendAckBit(AcknowledgmentType const ack) const -> void {
   transmitBit(1);
 }
 
-auto Driver::waitBusLow() -> void {
+auto Driver::transmitFrame(Frame const& frame) -> TransmitResult {
+  auto const symbols = frame.getSymbols();
+
+  m_replayIndex  = 0;
+  m_replayCount  = 0;
+  m_activityTick = xTaskGetTickCount();
+
+  if (m_transmitMode != TransmitMode::BIT_BANG) {
+    m_isFrameCaptured   = false;
+    m_transmitStartTime = getBusTime();
+    m_frameStartTime    = *m_transmitStartTime;
+
+    auto const isTransmitted = transmitSymbols(symbols);
+    if (not isTransmitted) {
+      return TransmitResult::FAILED;
+    }
+
+    return receiveTransmitEcho(symbols);
+  }
+
+  for (Size i = 0; i < symbols.size(); ++i) {
+    auto const symbol = symbols[i];
+
+    switch (symbol) {
+    case Symbol::START_BIT:
+      transmitStartBit();
+      break;
+    case Symbol::BIT_0:
+    case Symbol::BIT_1: {
+      auto const bit = static_cast<Bit>(symbol == Symbol::BIT_1 ? 1 : 0);
+
+      auto const isArbitrationBit = i > 0 and i <= ARBITRATION_BIT_SIZE;
+      if (not isArbitrationBit) {
+        transmitBit(bit);
+        break;
+      }
+
+      auto const isWon = transmitArbitrationBit(bit);
+      if (not isWon) {
+        receiveArbitrationWinner(symbols, i);
+        return TransmitResult::ARBITRATION_LOST;
+      }
+      break;
+    }
+    case Symbol::ACK_SLOT:
+      if (receiveAckBit() != AcknowledgmentType::ACK) {
+        return TransmitResult::NOT_ACKNOWLEDGED;
+      }
+      break;
+    }
+  }
+
+  return TransmitResult::ACKNOWLEDGED;
+}
+
+auto Driver::transmitArbitrationBit(Bit const bit) -> bool {
+  auto const txPin       = static_cast<gpio_num_t>(m_txPin);
+  auto const timing      = m_bitTiming.getTiming();
+  auto const startCycles = getCycles();
+
+  gpio_set_level(txPin, 1);
+
+  if (bit == 0) {
+    delayUS(timing.bit0HighUS);
+    gpio_set_level(txPin, 0);
+    delayUS(DATA_BIT_TOTAL_US - timing.bit0HighUS);
+    return true;
+  }
+
+  delayUS(timing.bit1HighUS);
+  gpio_set_level(txPin, 0);
+
+  auto const sampleCycles = toCycles(timing.thresholdUS);
+  while (not isElapsed(startCycles, sampleCycles)) {
+  }
+
+  if (isBusHigh()) {
+    return false;
+  }
+
+  auto const bitCycles = toCycles(DATA_BIT_TOTAL_US);
+  while (not isElapsed(startCycles, bitCycles)) {
+  }
+
+  return true;
+}
+
+auto Driver::receiveArbitrationWinner(Frame::Symbols const symbols, Size const lostIndex) -> void {
+  for (Size i = 1; i < lostIndex; ++i) {
+    m_replayBits[m_replayCount++] = symbols[i] == Symbol::BIT_1 ? 1 : 0;
+  }
+
+  m_replayBits[m_replayCount++] = 0;
+
+  if (m_receiveMode == ReceiveMode::POLLING) {
+    [[maybe_unused]] auto const isBusLow = waitBusLow(EDGE_TIMEOUT_US);
+    return;
+  }
+
+  while (auto const pulse = takePulse(PULSE_TIMEOUT)) {
+    if (isStartBitWidth(pulse->highTime) and isTransmitEcho(pulse->timestamp)) {
+      m_isFrameCaptured = true;
+      m_lastPulseEnd    = pulse->timestamp + pulse->highTime;
+      break;
+    }
+  }
+
+  for (Size i = 1; i <= lostIndex and m_isFrameCaptured; ++i) {
+    [[maybe_unused]] auto const pulse = receiveFramePulse();
+  }
+
+  m_transmitStartTime = std::nullopt;
+}
+
+auto Driver::receiveCapturedStartBit(TickType_t const timeout) -> bool {
+  m_isFrameCaptured = false;
+
+  while (true) {
+    auto const pulse = takePulse(timeout);
+    if (not pulse) {
+      return false;
+    }
+
+    if (not isStartBitWidth(pulse->highTime)) {
+      if (pulse->highTime > DATA_BIT_TOTAL_US) {
+        m_statistics.countStartBitReject();
+      }
+
+      continue;
+    }
+
+    if (isTransmitEcho(pulse->timestamp)) {
+      continue;
+    }
+
+    m_isFrameCaptured = true;
+    m_lastPulseEnd    = pulse->timestamp + pulse->highTime;
+    m_frameStartTime  = pulse->timestamp;
+    return true;
+  }
+}
+
+auto Driver::receiveFramePulse() -> std::optional<Pulse> {
+  auto const pulse = takePulse(PULSE_TIMEOUT);
+
+  auto const isFrameOver = not pulse or pulse->timestamp - m_lastPulseEnd > EDGE_TIMEOUT_US;
+  if (isFrameOver) {
+    m_pendingPulse    = pulse;
+    m_isFrameCaptured = false;
+    return std::nullopt;
+  }
+
+  m_lastPulseEnd = pulse->timestamp + pulse->highTime;
+
+  return pulse;
+}
+
+auto Driver::takePulse(TickType_t const timeout) -> std::optional<Pulse> {
+  if (m_pendingPulse) {
+    auto const pulse = m_pendingPulse;
+    m_pendingPulse   = std::nullopt;
+    return pulse;
+  }
+
+  if (m_receiveMode == ReceiveMode::BACKEND) {
+    return m_backend->receive(toTimeoutUS(timeout));
+  }
+
+  if (m_receiveMode == ReceiveMode::RMT) {
+    return waitCapturedPulse(timeout);
+  }
+
+  return waitEdgePulse(timeout);
+}
+
+auto Driver::nextCapturedPulse() -> std::optional<Pulse> {
+  if (not m_capture) {
+    return std::nullopt;
+  }
+
+  auto const& symbols = m_capture->symbols;
+  if (m_captureIndex >= symbols.size()) {
+    return std::nullopt;
+  }
+
+  auto const& symbol = symbols[m_captureIndex++];
+
+  Pulse const pulse = {
+      .timestamp = m_captureTime,
+      .highTime  = symbol.level0 ? symbol.duration0 : symbol.duration1,
+  };
+
+  m_captureTime += symbol.duration0 + symbol.duration1;
+
+  return pulse;
+}
+
+auto Driver::waitCapturedPulse(TickType_t const timeout) -> std::optional<Pulse> {
+  while (true) {
+    auto const pulse = nextCapturedPulse();
+    if (pulse) {
+      return pulse;
+    }
+
+    m_capture = m_rmtReceiver.receive(timeout);
+    if (not m_capture) {
+      return std::nullopt;
+    }
+
+    m_captureIndex = 0;
+    m_captureTime  = m_capture->timestamp;
+  }
+}
+
+auto Driver::receiveTransmitEcho(Frame::Symbols const symbols) -> TransmitResult {
+  while (true) {
+    auto const pulse = takePulse(pdMS_TO_TICKS(ECHO_TIMEOUT_MS));
+    if (not pulse) {
+      ESP_LOGW(TAG, "Transmitted frame is not captured");
+      return TransmitResult::FAILED;
+    }
+
+    if (isStartBitWidth(pulse->highTime) and isTransmitEcho(pulse->timestamp)) {
+      m_isFrameCaptured = true;
+      m_lastPulseEnd    = pulse->timestamp + pulse->highTime;
+      break;
+    }
+  }
+
+  for (auto const symbol : symbols.subspan(1)) {
+    auto const pulse = receiveFramePulse();
+    if (not pulse) {
+      return TransmitResult::FAILED;
+    }
+
+    auto const bit = m_bitTiming.classify(pulse->highTime);
+
+    if (symbol == Symbol::ACK_SLOT) {
+      if (bit != 0) {
+        m_isFrameCaptured = false;
+        return TransmitResult::NOT_ACKNOWLEDGED;
+      }
+
+      continue;
+    }
+
+    auto const expectedBit = static_cast<Bit>(symbol == Symbol::BIT_1 ? 1 : 0);
+    if (bit != expectedBit) {
+      m_isFrameCaptured = false;
+      return TransmitResult::COLLISION;
+    }
+  }
+
+  m_isFrameCaptured = false;
+
+  return TransmitResult::ACKNOWLEDGED;
+}
+
+auto Driver::waitEdgePulse(TickType_t const timeout) -> std::optional<Pulse> {
+  while (true) {
+    if (m_edgeIndex >= m_edgeCount) {
+      m_edgeIndex = 0;
+      m_edgeCount = m_edgeCapture.receive(m_edges, timeout);
+      if (m_edgeCount == 0) {
+        return std::nullopt;
+      }
+    }
+
+    auto const& edge = m_edges[m_edgeIndex++];
+
+    if (edge.level) {
+      m_riseTime = edge.timestamp;
+      continue;
+    }
+
+    if (not m_riseTime) {
+      continue;
+    }
+
+    Pulse const pulse = {
+        .timestamp = *m_riseTime,
+        .highTime  = edge.timestamp - *m_riseTime,
+    };
+
+    m_riseTime = std::nullopt;
+
+    return pulse;
+  }
+}
+
+auto Driver::isTransmitEcho(Time const timestamp) const -> bool {
+  if (not m_transmitStartTime) {
+    return false;
+  }
+
+  auto const timeDifference = std::abs(timestamp - *m_transmitStartTime);
+  return timeDifference <= START_BIT_TOTAL_US;
+}
+
+auto Driver::applyBitTiming() -> void {
+  auto const timing = m_bitTiming.getTiming();
+
+  m_rmtTransmitter.setBitTiming(timing.bit0HighUS, timing.bit1HighUS);
+}
+
+auto Driver::transmitSymbols(Frame::Symbols const symbols) -> bool {
+  if (m_backend != nullptr) {
+    return m_backend->transmit(symbols);
+  }
+
+  return m_rmtTransmitter.transmit(symbols);
+}
+
+auto Driver::transmitSymbol(Symbol const symbol) -> void {
+  [[maybe_unused]] auto const isTransmitted = transmitSymbols({&symbol, 1});
+}
+
+auto Driver::waitRisingEdge(TickType_t const timeout) -> std::optional<Time> {
+  if (isBusHigh()) {
+    auto const isBusLow = waitBusLow(START_BIT_TOTAL_US);
+    if (not isBusLow) {
+      return std::nullopt;
+    }
+  }
+
+  if (not m_isLowPowerListen) {
+    auto const isEdge = waitEdgeInterrupt(timeout);
+    if (not isEdge) {
+      return std::nullopt;
+    }
+
+    return m_edgeTime;
+  }
+
+  auto sleepTimeout = timeout;
+
+  auto const quietTicks = xTaskGetTickCount() - m_activityTick;
+  if (quietTicks < LISTEN_HOLD_TIMEOUT) {
+    auto const holdTimeout = std::min<TickType_t>(timeout, LISTEN_HOLD_TIMEOUT - quietTicks);
+
+    auto const isEdge = waitEdgeInterrupt(holdTimeout);
+    if (isEdge) {
+      return m_edgeTime;
+    }
+
+    if (timeout != portMAX_DELAY) {
+      sleepTimeout -= holdTimeout;
+    }
+
+    if (sleepTimeout == 0) {
+      return std::nullopt;
+    }
+  }
+
+  auto const isEdge = waitWakeupEdge(sleepTimeout);
+  if (not isEdge) {
+    return std::nullopt;
+  }
+
+  return m_edgeTime;
+}
+
+auto Driver::waitEdgeInterrupt(TickType_t const timeout) -> bool {
+  auto const rxPin = static_cast<gpio_num_t>(m_rxPin);
+
+  ulTaskNotifyTake(pdTRUE, 0);
+
+  m_edgeWaitingTask = xTaskGetCurrentTaskHandle();
+  gpio_intr_enable(rxPin);
+
+  ulTaskNotifyTake(pdTRUE, timeout);
+
+  gpio_intr_disable(rxPin);
+
+  auto const waitingTask = m_edgeWaitingTask.exchange(nullptr);
+  if (waitingTask != nullptr) {
+    return false;
+  }
+
+  ulTaskNotifyTake(pdTRUE, 0);
+
+  return true;
+}
+
+auto Driver::waitWakeupEdge(TickType_t const timeout) -> bool {
+  auto const rxPin = static_cast<gpio_num_t>(m_rxPin);
+
+  gpio_wakeup_enable(rxPin, GPIO_INTR_HIGH_LEVEL);
+
+  m_powerLock.release();
+
+  auto const isEdge = waitEdgeInterrupt(timeout);
+
+  m_powerLock.acquire();
+
+  gpio_wakeup_disable(rxPin);
+  gpio_set_intr_type(rxPin, getEdgeInterruptType(m_receiveMode));
+
+  m_isWakeupEdge = isEdge;
+
+  return isEdge;
+}
+
+auto Driver::pollBusFree(TickType_t const timeout) const -> bool {
+  auto const startTick = xTaskGetTickCount();
+
+  while (not isBusFree()) {
+    auto const isTimeout = timeout != portMAX_DELAY and xTaskGetTickCount() - startTick >= timeout;
+    if (isTimeout) {
+      return false;
+    }
+
+    delayUS(1);
+  }
+
+  return true;
+}
+
+auto Driver::waitBusLow(Time const timeoutUS) const -> bool {
+  auto const startCycles   = getCycles();
+  auto const timeoutCycles = toCycles(timeoutUS);
+
   while (isBusHigh()) {
-    vTaskDelay(pdMS_TO_TICKS(1));
+    if (isElapsed(startCycles, timeoutCycles)) {
+      return false;
+    }
   }
+
+  return true;
 }
 
-auto Driver::waitBusHigh() -> void {
+auto Driver::waitBusHigh(Time const timeoutUS) const -> bool {
+  auto const startCycles   = getCycles();
+  auto const timeoutCycles = toCycles(timeoutUS);
+
   while (isBusLow()) {
-    vTaskDelay(pdMS_TO_TICKS(1));
+    if (isElapsed(startCycles, timeoutCycles)) {
+      return false;
+    }
   }
+
+  return true;
+}
+
+auto IRAM_ATTR Driver::onEdge(void* const context) -> void {
+  auto* const driver = static_cast<Driver*>(context);
+
+  driver->m_idleDetector.onEdge(static_cast<Bit>(gpio_get_level(static_cast<gpio_num_t>(driver->m_rxPin))));
+
+  auto const waitingTask = driver->m_edgeWaitingTask.exchange(nullptr);
+  if (waitingTask == nullptr) {
+    return;
+  }
+
+  driver->m_edgeTime = esp_timer_get_time();
+
+  // Single shot, the wakeup interrupt is level triggered
+  gpio_intr_disable(static_cast<gpio_num_t>(driver->m_rxPin));
+
+  // No op unless the locks were released for light sleep
+  driver->m_powerLock.acquireFromISR();
+
+  BaseType_t isTaskWoken = pdFALSE;
+  vTaskNotifyGiveFromISR(waitingTask, &isTaskWoken);
+
+  if (isTaskWoken == pdTRUE) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+auto IRAM_ATTR Driver::onCapturedEdge(Bit const level, void* const context) -> void {
+  auto* const driver = static_cast<Driver*>(context);
+
+  driver->m_idleDetector.onEdge(level);
 }
 
 } // namespace iebus
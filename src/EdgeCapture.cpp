@@ -0,0 +1,194 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/EdgeCapture.hpp"
+
+#include <driver/gpio.h>
+#include <esp_attr.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+
+namespace iebus {
+
+namespace {
+
+auto constexpr TAG = "IEBusEdgeCapture";
+
+auto constexpr TIMESTAMP_MASK = 0x7FFF'FFFFU;
+
+} // namespace
+
+EdgeCapture::EdgeCapture(EdgeCapture::Pin const rx) noexcept : m_rxPin(rx) {
+}
+
+EdgeCapture::~EdgeCapture() {
+  disable();
+}
+
+auto EdgeCapture::isEnabled() const -> bool {
+  return m_isEnabled;
+}
+
+auto EdgeCapture::getOverflowCount() const -> std::uint32_t {
+  return m_overflowCount.load(std::memory_order_relaxed);
+}
+
+auto EdgeCapture::setEdgeHandler(EdgeHandler const handler, void* const context) -> void {
+  m_edgeHandler = handler;
+  m_edgeContext = context;
+}
+
+auto EdgeCapture::enable() -> bool {
+  if (isEnabled()) {
+    return true;
+  }
+
+  auto const rxPin = static_cast<gpio_num_t>(m_rxPin);
+
+  auto result = gpio_install_isr_service(0);
+  if (result != ESP_OK and result != ESP_ERR_INVALID_STATE) {
+    ESP_LOGE(TAG, "Failed to install GPIO ISR service: %s", esp_err_to_name(result));
+    return false;
+  }
+
+  gpio_set_intr_type(rxPin, GPIO_INTR_ANYEDGE);
+
+  result = gpio_isr_handler_add(rxPin, onEdge, this);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to add edge handler: %s", esp_err_to_name(result));
+    return false;
+  }
+
+  gpio_intr_enable(rxPin);
+
+  m_isEnabled = true;
+  return true;
+}
+
+auto EdgeCapture::disable() -> void {
+  if (not isEnabled()) {
+    return;
+  }
+
+  auto const rxPin = static_cast<gpio_num_t>(m_rxPin);
+
+  gpio_intr_disable(rxPin);
+  gpio_isr_handler_remove(rxPin);
+  gpio_set_intr_type(rxPin, GPIO_INTR_DISABLE);
+
+  while (m_edges.pop()) {
+  }
+
+  m_isEnabled = false;
+}
+
+auto EdgeCapture::receive(std::span<Edge> const edges, TickType_t const timeout) -> Size {
+  if (not isEnabled()) {
+    return 0;
+  }
+
+  auto count = takeEdges(edges);
+  if (count > 0) {
+    return count;
+  }
+
+  ulTaskNotifyTake(pdTRUE, 0);
+  m_waitingTask = xTaskGetCurrentTaskHandle();
+
+  if (m_edges.isEmpty()) {
+    ulTaskNotifyTake(pdTRUE, timeout);
+  }
+
+  auto const waitingTask = m_waitingTask.exchange(nullptr);
+  if (waitingTask == nullptr) {
+    ulTaskNotifyTake(pdTRUE, 0);
+  }
+
+  count = takeEdges(edges);
+
+  return count;
+}
+
+auto EdgeCapture::armWakeup(TaskHandle_t const task) -> bool {
+  if (not isEnabled()) {
+    return true;
+  }
+
+  m_waitingTask = task;
+
+  if (not m_edges.isEmpty()) {
+    m_waitingTask = nullptr;
+    return false;
+  }
+
+  return true;
+}
+
+auto EdgeCapture::takeEdges(std::span<Edge> const edges) -> Size {
+  auto const batchSize = edges.size() < m_batch.size() ? edges.size() : m_batch.size();
+  auto const count     = m_edges.pop(std::span(m_batch).first(batchSize));
+  if (count == 0) {
+    return 0;
+  }
+
+  auto const currentTime   = esp_timer_get_time();
+  auto const currentPacked = static_cast<std::uint32_t>(currentTime) & TIMESTAMP_MASK;
+
+  for (Size i = 0; i < count; ++i) {
+    auto const packedEdge = m_batch[i];
+    auto const age        = (currentPacked - (packedEdge >> 1)) & TIMESTAMP_MASK;
+
+    edges[i] = {
+        .timestamp = currentTime - age,
+        .level     = static_cast<Bit>(packedEdge & 1),
+    };
+  }
+
+  return count;
+}
+
+auto IRAM_ATTR EdgeCapture::onEdge(void* const context) -> void {
+  auto* const capture = static_cast<EdgeCapture*>(context);
+
+  auto const timestamp  = static_cast<std::uint32_t>(esp_timer_get_time());
+  auto const level      = static_cast<std::uint32_t>(gpio_get_level(static_cast<gpio_num_t>(capture->m_rxPin)));
+  auto const packedEdge = (timestamp << 1) | level;
+
+  auto const isPushed = capture->m_edges.push(packedEdge);
+  if (not isPushed) {
+    capture->m_overflowCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if (capture->m_edgeHandler != nullptr) {
+    capture->m_edgeHandler(static_cast<Bit>(level), capture->m_edgeContext);
+  }
+
+  auto const waitingTask = capture->m_waitingTask.exchange(nullptr);
+  if (waitingTask == nullptr) {
+    return;
+  }
+
+  BaseType_t isTaskWoken = pdFALSE;
+  vTaskNotifyGiveFromISR(waitingTask, &isTaskWoken);
+
+  if (isTaskWoken == pdTRUE) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+} // namespace iebus
@@ -0,0 +1,60 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/Frame.hpp"
+
+namespace iebus {
+
+auto Frame::getSymbols() const -> Symbols {
+  return {m_symbols.data(), m_size};
+}
+
+auto Frame::clear() -> void {
+  m_size = 0;
+}
+
+auto Frame::appendStartBit() -> void {
+  append(Symbol::START_BIT);
+}
+
+auto Frame::appendBit(Bit const bit) -> void {
+  append(bit ? Symbol::BIT_1 : Symbol::BIT_0);
+}
+
+auto Frame::appendBits(Data const data, Size const numBits) -> void {
+  for (Size i = 0; i < numBits; ++i) {
+    auto const bitPosition = numBits - 1 - i;
+    auto const bit         = static_cast<Bit>(data >> bitPosition & 1);
+
+    appendBit(bit);
+  }
+}
+
+auto Frame::appendAckSlot() -> void {
+  append(Symbol::ACK_SLOT);
+}
+
+auto Frame::append(Symbol const symbol) -> void {
+  if (m_size >= m_symbols.size()) {
+    return;
+  }
+
+  m_symbols[m_size++] = symbol;
+}
+
+} // namespace iebus
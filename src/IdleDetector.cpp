@@ -0,0 +1,194 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/IdleDetector.hpp"
+
+#include <driver/gpio.h>
+#include <esp_attr.h>
+#include <esp_log.h>
+
+#include "protocol.hpp"
+
+namespace iebus {
+
+namespace {
+
+auto constexpr TAG = "IEBusIdleDetector";
+
+auto constexpr TIMER_NAME = "iebus_idle";
+
+/**
+ * Low level time after which the bus is free
+ */
+auto constexpr IDLE_TIME_US = DATA_BIT_TOTAL_US;
+
+#ifdef CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
+auto constexpr TIMER_DISPATCH = ESP_TIMER_ISR;
+#else
+auto constexpr TIMER_DISPATCH = ESP_TIMER_TASK;
+#endif
+
+} // namespace
+
+IdleDetector::IdleDetector(IdleDetector::Pin const rx) noexcept : m_rxPin(rx) {
+}
+
+IdleDetector::~IdleDetector() {
+  disable();
+}
+
+auto IdleDetector::isEnabled() const -> bool {
+  return m_timer != nullptr;
+}
+
+auto IdleDetector::isIdle() const -> bool {
+  return m_isIdle.load();
+}
+
+auto IdleDetector::enable() -> bool {
+  if (isEnabled()) {
+    return true;
+  }
+
+  esp_timer_create_args_t const timerConfiguration = {
+      .callback              = onTimer,
+      .arg                   = this,
+      .dispatch_method       = TIMER_DISPATCH,
+      .name                  = TIMER_NAME,
+      .skip_unhandled_events = true,
+  };
+
+  auto const result = esp_timer_create(&timerConfiguration, &m_timer);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to create idle timer: %s", esp_err_to_name(result));
+    m_timer = nullptr;
+    return false;
+  }
+
+  return true;
+}
+
+auto IdleDetector::disable() -> void {
+  if (not isEnabled()) {
+    return;
+  }
+
+  stop();
+
+  esp_timer_delete(m_timer);
+  m_timer = nullptr;
+}
+
+auto IdleDetector::start() -> void {
+  if (not isEnabled()) {
+    return;
+  }
+
+  portENTER_CRITICAL(&m_lock);
+
+  m_isWatching = true;
+  arm(static_cast<Bit>(gpio_get_level(static_cast<gpio_num_t>(m_rxPin))));
+
+  portEXIT_CRITICAL(&m_lock);
+}
+
+auto IdleDetector::stop() -> void {
+  if (not isEnabled()) {
+    return;
+  }
+
+  portENTER_CRITICAL(&m_lock);
+
+  m_isWatching = false;
+  esp_timer_stop(m_timer);
+
+  portEXIT_CRITICAL(&m_lock);
+}
+
+auto IRAM_ATTR IdleDetector::onEdge(Bit const level) -> void {
+  if (not m_isWatching.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  portENTER_CRITICAL_ISR(&m_lock);
+  arm(level);
+  portEXIT_CRITICAL_ISR(&m_lock);
+}
+
+auto IdleDetector::wait(TickType_t const timeout) -> bool {
+  if (not isEnabled()) {
+    return false;
+  }
+
+  ulTaskNotifyTake(pdTRUE, 0);
+  m_waitingTask = xTaskGetCurrentTaskHandle();
+
+  auto const startTick = xTaskGetTickCount();
+
+  while (not isIdle()) {
+    auto const elapsed = xTaskGetTickCount() - startTick;
+    if (timeout != portMAX_DELAY and elapsed >= timeout) {
+      break;
+    }
+
+    ulTaskNotifyTake(pdTRUE, timeout == portMAX_DELAY ? portMAX_DELAY : timeout - elapsed);
+  }
+
+  m_waitingTask = nullptr;
+
+  return isIdle();
+}
+
+auto IRAM_ATTR IdleDetector::arm(Bit const level) -> void {
+  esp_timer_stop(m_timer);
+
+  m_isIdle = false;
+
+  if (level == 0) {
+    esp_timer_start_once(m_timer, IDLE_TIME_US);
+  }
+}
+
+auto IRAM_ATTR IdleDetector::onTimer(void* const context) -> void {
+  auto* const detector = static_cast<IdleDetector*>(context);
+
+  // Timer may race with a rising edge, the line level decides
+  auto const isLow = gpio_get_level(static_cast<gpio_num_t>(detector->m_rxPin)) == 0;
+
+  portENTER_CRITICAL_ISR(&detector->m_lock);
+  detector->m_isIdle = detector->m_isWatching and isLow;
+  portEXIT_CRITICAL_ISR(&detector->m_lock);
+
+  auto const waitingTask = detector->m_waitingTask.load();
+  if (waitingTask == nullptr) {
+    return;
+  }
+
+#ifdef CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
+  BaseType_t isTaskWoken = pdFALSE;
+  vTaskNotifyGiveFromISR(waitingTask, &isTaskWoken);
+
+  if (isTaskWoken == pdTRUE) {
+    esp_timer_isr_dispatch_need_yield();
+  }
+#else
+  xTaskNotifyGive(waitingTask);
+#endif
+}
+
+} // namespace iebus
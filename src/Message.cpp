@@ -18,44 +18,37 @@
 
 #include "iebus/Message.hpp"
 
-#include <format>
+#include <iterator>
+#include <span>
 #include <string>
 
-namespace iebus {
-
-namespace {
+#include <iebus/MessageFormatter.hpp>
 
-auto formatBroadcastType(BroadcastType type) -> std::string {
-  switch (type) {
-  case BroadcastType::BROADCAST:
-    return "B";
-  case BroadcastType::FOR_DEVICE:
-    return "D";
-  }
+#include "formatting.hpp"
 
-  return "U";
-}
+namespace iebus {
 
-auto formatBytesHex(Bytes bytes) -> std::string {
+auto formatMessage(BroadcastType const broadcast, Address const master, Address const slave, Byte const control, std::span<Byte const> const data) -> std::string {
   std::string result;
+  result.reserve(MessageFormatter::getSize(data.size()));
 
-  Size const count = bytes.size();
+  MessageFormatter::format(std::back_inserter(result), broadcast, master, slave, control, data);
 
-  for (Size i = 0; i < bytes.size(); ++i) {
-    result += std::format("{:02X}", bytes[i]);
+  return result;
+}
 
-    if (i < count - 1) {
-      result += " ";
-    }
-  }
+auto Message::getData() const -> std::span<Byte const> {
+  auto const length = dataLength < data.size() ? dataLength : data.size();
 
-  return result;
+  return std::span(data).first(length);
 }
 
-} // namespace
+auto Message::format(std::span<char> const buffer) const -> Size {
+  return MessageFormatter::format(buffer, broadcast, master, slave, control, getData());
+}
 
 auto Message::toString() const -> std::string {
-  return std::format("{} M{:#06x} S{:#06x} C{:#04x} L{} [{}]", formatBroadcastType(broadcast), master, slave, control, dataLength, formatBytesHex(data));
+  return formatMessage(broadcast, master, slave, control, getData());
 }
 
 } // namespace iebus
@@ -0,0 +1,239 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#include "iebus/MessageCodec.hpp"
+
+#include <algorithm>
+
+namespace iebus {
+
+namespace {
+
+auto writeUint16(Byte* const destination, std::uint16_t const value) -> void {
+  destination[0] = static_cast<Byte>(value);
+  destination[1] = static_cast<Byte>(value >> 8);
+}
+
+auto readUint16(Byte const* const source) -> std::uint16_t {
+  return static_cast<std::uint16_t>(source[0] | source[1] << 8);
+}
+
+auto writeUint64(Byte* const destination, std::uint64_t const value) -> void {
+  for (Size i = 0; i < 8; ++i) {
+    destination[i] = static_cast<Byte>(value >> (i * 8));
+  }
+}
+
+auto readUint64(Byte const* const source) -> std::uint64_t {
+  std::uint64_t value = 0;
+
+  for (Size i = 0; i < 8; ++i) {
+    value |= static_cast<std::uint64_t>(source[i]) << (i * 8);
+  }
+
+  return value;
+}
+
+} // namespace
+
+auto MessageCodec::makeRecord(Message const& message, std::optional<Time> const timestamp) -> Record {
+  return {
+      .broadcast = message.broadcast,
+      .master    = message.master,
+      .slave     = message.slave,
+      .control   = message.control,
+      .data      = message.getData(),
+      .timestamp = timestamp,
+  };
+}
+
+auto MessageCodec::getSize(Record const& record) -> Size {
+  return HEADER_SIZE + (record.timestamp ? TIMESTAMP_SIZE : 0) + record.data.size();
+}
+
+auto MessageCodec::encode(Record const& record) -> Parts {
+  Parts parts = {
+      .headerBuffer = {},
+      .headerSize   = HEADER_SIZE,
+      .data         = record.data.first(std::min<Size>(record.data.size(), MAX_MESSAGE_SIZE)),
+  };
+
+  auto* const header = parts.headerBuffer.data();
+
+  std::uint8_t flags = 0;
+  if (record.broadcast == BroadcastType::BROADCAST) {
+    flags |= FLAG_BROADCAST;
+  }
+  if (record.timestamp) {
+    flags |= FLAG_TIMESTAMP;
+  }
+
+  header[2] = flags;
+  header[3] = record.control;
+  writeUint16(header + 4, record.master);
+  writeUint16(header + 6, record.slave);
+
+  if (record.timestamp) {
+    writeUint64(header + HEADER_SIZE, static_cast<std::uint64_t>(*record.timestamp));
+    parts.headerSize += TIMESTAMP_SIZE;
+  }
+
+  writeUint16(header, static_cast<std::uint16_t>(parts.headerSize + parts.data.size()));
+
+  return parts;
+}
+
+auto MessageCodec::encode(Record const& record, std::span<Byte> const buffer) -> Size {
+  auto const parts = encode(record);
+  auto const size  = parts.headerSize + parts.data.size();
+
+  if (buffer.size() < size) {
+    return 0;
+  }
+
+  auto const header = parts.getHeader();
+
+  std::copy(header.begin(), header.end(), buffer.begin());
+  std::copy(parts.data.begin(), parts.data.end(), buffer.begin() + static_cast<std::ptrdiff_t>(header.size()));
+
+  return size;
+}
+
+auto MessageCodec::decode(std::span<Byte const> const buffer) -> std::optional<Record> {
+  if (buffer.size() < HEADER_SIZE) {
+    return std::nullopt;
+  }
+
+  auto const* const header = buffer.data();
+
+  Size const size    = readUint16(header);
+  auto const flags   = header[2];
+  auto const hasTime = (flags & FLAG_TIMESTAMP) != 0;
+
+  Size const headerSize = HEADER_SIZE + (hasTime ? TIMESTAMP_SIZE : 0);
+  if (size < headerSize or size > buffer.size() or size - headerSize > MAX_MESSAGE_SIZE) {
+    return std::nullopt;
+  }
+
+  Record record = {
+      .broadcast = (flags & FLAG_BROADCAST) != 0 ? BroadcastType::BROADCAST : BroadcastType::FOR_DEVICE,
+      .master    = readUint16(header + 4),
+      .slave     = readUint16(header + 6),
+      .control   = header[3],
+      .data      = buffer.subspan(headerSize, size - headerSize),
+      .timestamp = std::nullopt,
+  };
+
+  if (hasTime) {
+    record.timestamp = static_cast<Time>(readUint64(header + HEADER_SIZE));
+  }
+
+  return record;
+}
+
+auto MessageCodec::toMessage(Record const& record, Message& message) -> void {
+  auto const data = record.data.first(std::min<Size>(record.data.size(), MAX_MESSAGE_SIZE));
+
+  message.broadcast  = record.broadcast;
+  message.master     = record.master;
+  message.slave      = record.slave;
+  message.control    = record.control;
+  message.dataLength = data.size();
+
+  std::copy(data.begin(), data.end(), message.data.begin());
+}
+
+MessageBatchWriter::MessageBatchWriter(std::span<Byte> const buffer) noexcept : m_buffer(buffer) {
+  reset();
+}
+
+auto MessageBatchWriter::getCount() const -> Size {
+  return m_count;
+}
+
+auto MessageBatchWriter::getData() const -> std::span<Byte const> {
+  return m_buffer.first(m_size);
+}
+
+auto MessageBatchWriter::append(MessageCodec::Record const& record) -> bool {
+  if (m_size < HEADER_SIZE or m_count >= UINT16_MAX) {
+    return false;
+  }
+
+  auto const size = MessageCodec::encode(record, m_buffer.subspan(m_size));
+  if (size == 0) {
+    return false;
+  }
+
+  m_size += size;
+  m_count += 1;
+
+  writeUint16(m_buffer.data() + 2, static_cast<std::uint16_t>(m_count));
+
+  return true;
+}
+
+auto MessageBatchWriter::reset() -> void {
+  m_size  = 0;
+  m_count = 0;
+
+  if (m_buffer.size() < HEADER_SIZE) {
+    return;
+  }
+
+  m_buffer[0] = MAGIC;
+  m_buffer[1] = VERSION;
+  writeUint16(m_buffer.data() + 2, 0);
+
+  m_size = HEADER_SIZE;
+}
+
+MessageBatchReader::MessageBatchReader(std::span<Byte const> const buffer) noexcept : m_buffer(buffer) {
+  if (not isValid()) {
+    return;
+  }
+
+  m_offset = MessageBatchWriter::HEADER_SIZE;
+  m_count  = readUint16(m_buffer.data() + 2);
+}
+
+auto MessageBatchReader::isValid() const -> bool {
+  return m_buffer.size() >= MessageBatchWriter::HEADER_SIZE and m_buffer[0] == MessageBatchWriter::MAGIC and m_buffer[1] == MessageBatchWriter::VERSION;
+}
+
+auto MessageBatchReader::getCount() const -> Size {
+  return m_count;
+}
+
+auto MessageBatchReader::next() -> std::optional<MessageCodec::Record> {
+  if (m_index >= m_count) {
+    return std::nullopt;
+  }
+
+  auto const record = MessageCodec::decode(m_buffer.subspan(m_offset));
+  if (not record) {
+    m_index = m_count;
+    return std::nullopt;
+  }
+
+  m_offset += MessageCodec::getSize(*record);
+  m_index += 1;
+
+  return record;
+}
+
+} // namespace iebus
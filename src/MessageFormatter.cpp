@@ -0,0 +1,84 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#include "iebus/MessageFormatter.hpp"
+
+#include <cstddef>
+#include <iterator>
+
+namespace iebus {
+
+namespace {
+
+/**
+ * Output iterator dropping chars past the end of the buffer
+ */
+class BoundedOutput {
+public:
+  using difference_type = std::ptrdiff_t;
+
+public:
+  BoundedOutput(char* const begin, char* const end) noexcept : m_position(begin), m_end(end) {
+  }
+
+public:
+  [[nodiscard]] auto getPosition() const -> char* {
+    return m_position;
+  }
+
+public:
+  auto operator*() -> BoundedOutput& {
+    return *this;
+  }
+
+  auto operator++() -> BoundedOutput& {
+    return *this;
+  }
+
+  auto operator++(int) -> BoundedOutput& {
+    return *this;
+  }
+
+  auto operator=(char const value) -> BoundedOutput& {
+    if (m_position != m_end) {
+      *m_position++ = value;
+    }
+
+    return *this;
+  }
+
+private:
+  char* m_position;
+  char* m_end;
+};
+
+} // namespace
+
+auto MessageFormatter::format(std::span<char> const buffer, BroadcastType const broadcast, Address const master, Address const slave, Byte const control,
+                              std::span<Byte const> const data) -> Size {
+  if (buffer.empty()) {
+    return 0;
+  }
+
+  auto const out = format(BoundedOutput(buffer.data(), buffer.data() + buffer.size() - 1), broadcast, master, slave, control, data);
+
+  *out.getPosition() = '\0';
+
+  return static_cast<Size>(out.getPosition() - buffer.data());
+}
+
+} // namespace iebus
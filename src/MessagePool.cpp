@@ -0,0 +1,169 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/MessagePool.hpp"
+
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <utility>
+
+namespace iebus {
+
+namespace {
+
+auto constexpr TAG = "IEBusMessagePool";
+
+} // namespace
+
+MessagePool::Handle::Handle(MessagePool* const pool, Message* const message) noexcept : m_pool(pool), m_message(message) {
+}
+
+MessagePool::Handle::~Handle() {
+  reset();
+}
+
+MessagePool::Handle::Handle(Handle&& other) noexcept : m_pool(std::exchange(other.m_pool, nullptr)), m_message(std::exchange(other.m_message, nullptr)) {
+}
+
+auto MessagePool::Handle::operator=(Handle&& other) noexcept -> Handle& {
+  if (this != &other) {
+    reset();
+
+    m_pool    = std::exchange(other.m_pool, nullptr);
+    m_message = std::exchange(other.m_message, nullptr);
+  }
+
+  return *this;
+}
+
+MessagePool::Handle::operator bool() const {
+  return m_message != nullptr;
+}
+
+auto MessagePool::Handle::operator*() const -> Message& {
+  return *m_message;
+}
+
+auto MessagePool::Handle::operator->() const -> Message* {
+  return m_message;
+}
+
+auto MessagePool::Handle::get() const -> Message* {
+  return m_message;
+}
+
+auto MessagePool::Handle::detach() -> Message* {
+  m_pool = nullptr;
+  return std::exchange(m_message, nullptr);
+}
+
+auto MessagePool::Handle::reset() -> void {
+  if (m_pool != nullptr and m_message != nullptr) {
+    m_pool->release(m_message);
+  }
+
+  m_pool    = nullptr;
+  m_message = nullptr;
+}
+
+MessagePool::~MessagePool() {
+  destroy();
+}
+
+auto MessagePool::getCapacity() const -> Size {
+  return m_capacity;
+}
+
+auto MessagePool::getAvailable() const -> Size {
+  if (m_free == nullptr) {
+    return 0;
+  }
+
+  return uxQueueMessagesWaiting(m_free);
+}
+
+auto MessagePool::create(Size const capacity) -> bool {
+  if (m_messages != nullptr) {
+    if (capacity == m_capacity) {
+      return true;
+    }
+
+    if (getAvailable() != m_capacity) {
+      ESP_LOGE(TAG, "Messages are still in use");
+      return false;
+    }
+
+    destroy();
+  }
+
+  m_messages = static_cast<Message*>(heap_caps_calloc(capacity, sizeof(Message), MALLOC_CAP_8BIT));
+  m_free     = xQueueCreate(capacity, sizeof(Message*));
+
+  if (m_messages == nullptr or m_free == nullptr) {
+    ESP_LOGE(TAG, "Failed to allocate %u messages", capacity);
+    destroy();
+    return false;
+  }
+
+  m_capacity = capacity;
+
+  for (Size i = 0; i < capacity; ++i) {
+    release(&m_messages[i]);
+  }
+
+  return true;
+}
+
+auto MessagePool::acquire() -> Handle {
+  if (m_free == nullptr) {
+    return {};
+  }
+
+  Message* message = nullptr;
+
+  auto const isAcquired = xQueueReceive(m_free, &message, 0) == pdTRUE;
+  if (not isAcquired) {
+    return {};
+  }
+
+  return {this, message};
+}
+
+auto MessagePool::attach(Message* const message) -> Handle {
+  return {this, message};
+}
+
+auto MessagePool::release(Message* const message) -> void {
+  xQueueSend(m_free, &message, 0);
+}
+
+auto MessagePool::destroy() -> void {
+  if (m_free != nullptr) {
+    vQueueDelete(m_free);
+    m_free = nullptr;
+  }
+
+  if (m_messages != nullptr) {
+    heap_caps_free(m_messages);
+    m_messages = nullptr;
+  }
+
+  m_capacity = 0;
+}
+
+} // namespace iebus
@@ -0,0 +1,117 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/PowerLock.hpp"
+
+#include <esp_attr.h>
+#include <esp_log.h>
+
+#include "common.hpp"
+
+namespace iebus {
+
+namespace {
+
+auto constexpr TAG = "IEBusPowerLock";
+
+auto constexpr FREQUENCY_LOCK_NAME = "iebus_cpu";
+auto constexpr SLEEP_LOCK_NAME     = "iebus_sleep";
+
+} // namespace
+
+PowerLock::~PowerLock() {
+  destroy();
+}
+
+auto PowerLock::isCreated() const -> bool {
+  return m_frequencyLock != nullptr and m_sleepLock != nullptr;
+}
+
+auto PowerLock::isAcquired() const -> bool {
+  return m_isAcquired;
+}
+
+auto PowerLock::create() -> bool {
+  if (isCreated()) {
+    return true;
+  }
+
+  auto result = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, FREQUENCY_LOCK_NAME, &m_frequencyLock);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to create frequency lock: %s", esp_err_to_name(result));
+    destroy();
+    return false;
+  }
+
+  result = esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, SLEEP_LOCK_NAME, &m_sleepLock);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to create sleep lock: %s", esp_err_to_name(result));
+    destroy();
+    return false;
+  }
+
+  return true;
+}
+
+auto PowerLock::destroy() -> void {
+  release();
+
+  if (m_frequencyLock != nullptr) {
+    esp_pm_lock_delete(m_frequencyLock);
+    m_frequencyLock = nullptr;
+  }
+
+  if (m_sleepLock != nullptr) {
+    esp_pm_lock_delete(m_sleepLock);
+    m_sleepLock = nullptr;
+  }
+}
+
+auto PowerLock::acquire() -> void {
+  if (not isCreated()) {
+    return;
+  }
+
+  acquireFromISR();
+
+  calibrateTimebase();
+}
+
+auto IRAM_ATTR PowerLock::acquireFromISR() -> void {
+  if (m_frequencyLock == nullptr or m_sleepLock == nullptr) {
+    return;
+  }
+
+  if (m_isAcquired.exchange(true)) {
+    return;
+  }
+
+  esp_pm_lock_acquire(m_sleepLock);
+  esp_pm_lock_acquire(m_frequencyLock);
+}
+
+auto PowerLock::release() -> void {
+  if (not m_isAcquired.exchange(false)) {
+    return;
+  }
+
+  esp_pm_lock_release(m_frequencyLock);
+  esp_pm_lock_release(m_sleepLock);
+}
+
+} // namespace iebus
@@ -0,0 +1,311 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/RmtReceiver.hpp"
+
+#include <driver/rmt_rx.h>
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <sdkconfig.h>
+#include <soc/soc_caps.h>
+
+#include "protocol.hpp"
+
+namespace iebus {
+
+namespace {
+
+auto constexpr TAG = "IEBusRmtReceiver";
+
+auto constexpr RESOLUTION_HZ = 1'000'000;
+auto constexpr BUFFER_COUNT  = 2;
+auto constexpr BUFFER_SIZE   = MAX_FRAME_BIT_SIZE + 64;
+
+/**
+ * Glitches shorter than this are filtered by hardware
+ */
+auto constexpr SIGNAL_MIN_NS = 1'000;
+/**
+ * Capture is finished when a level is kept longer than the start bit high period
+ */
+auto constexpr FRAME_END_US = START_BIT_MAX_HIGH_US + DATA_BIT_TOTAL_US;
+
+rmt_receive_config_t constexpr RECEIVE_CONFIGURATION = {
+    .signal_range_min_ns = SIGNAL_MIN_NS,
+    .signal_range_max_ns = FRAME_END_US * 1'000,
+    .flags               = {},
+};
+
+} // namespace
+
+RmtReceiver::RmtReceiver(RmtReceiver::Pin const rx) noexcept : m_rxPin(rx) {
+}
+
+RmtReceiver::~RmtReceiver() {
+  disable();
+}
+
+auto RmtReceiver::isEnabled() const -> bool {
+  return m_channel != nullptr;
+}
+
+auto RmtReceiver::enable() -> bool {
+  if (isEnabled()) {
+    return true;
+  }
+
+  m_buffers = static_cast<rmt_symbol_word_t*>(heap_caps_calloc(BUFFER_COUNT * BUFFER_SIZE, sizeof(rmt_symbol_word_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+  m_events  = xQueueCreate(BUFFER_COUNT, sizeof(Event));
+
+  if (m_buffers == nullptr or m_events == nullptr) {
+    ESP_LOGE(TAG, "Failed to allocate capture buffers");
+    disable();
+    return false;
+  }
+
+  rmt_rx_channel_config_t const channelConfiguration = {
+      .gpio_num          = static_cast<gpio_num_t>(m_rxPin),
+      .clk_src           = RMT_CLK_SRC_DEFAULT,
+      .resolution_hz     = RESOLUTION_HZ,
+      .mem_block_symbols = SOC_RMT_MEM_WORDS_PER_CHANNEL,
+      .intr_priority     = 0,
+      .flags             = {},
+  };
+
+  auto result = rmt_new_rx_channel(&channelConfiguration, &m_channel);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to create RMT channel: %s", esp_err_to_name(result));
+    m_channel = nullptr;
+    disable();
+    return false;
+  }
+
+  rmt_rx_event_callbacks_t const callbacks = {
+      .on_recv_done = onReceiveDone,
+  };
+
+  result = rmt_rx_register_event_callbacks(m_channel, &callbacks, this);
+  if (result == ESP_OK) {
+    result = rmt_enable(m_channel);
+  }
+
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to enable RMT channel: %s", esp_err_to_name(result));
+    disable();
+    return false;
+  }
+
+  m_freeBuffers      = (1U << BUFFER_COUNT) - 1;
+  m_heldBuffer       = std::nullopt;
+  m_isReceiveStalled = true;
+
+  releaseBuffer(0);
+
+  return true;
+}
+
+auto RmtReceiver::disable() -> void {
+  if (m_channel != nullptr) {
+    rmt_disable(m_channel);
+    rmt_del_channel(m_channel);
+    m_channel = nullptr;
+  }
+
+  if (m_events != nullptr) {
+    vQueueDelete(m_events);
+    m_events = nullptr;
+  }
+
+  if (m_buffers != nullptr) {
+    heap_caps_free(m_buffers);
+    m_buffers = nullptr;
+  }
+
+  m_heldBuffer = std::nullopt;
+}
+
+auto RmtReceiver::receive(TickType_t const timeout) -> std::optional<Capture> {
+  if (not isEnabled()) {
+    return std::nullopt;
+  }
+
+  if (m_heldBuffer) {
+    releaseBuffer(*m_heldBuffer);
+    m_heldBuffer = std::nullopt;
+  }
+
+  // Retry a capture that failed to restart, the queue would stay empty otherwise
+  resumeReceive();
+
+  Event event = {};
+
+  auto const isReceived = xQueueReceive(m_events, &event, timeout) == pdTRUE;
+  if (not isReceived) {
+    return std::nullopt;
+  }
+
+  m_heldBuffer = event.buffer;
+
+#ifndef CONFIG_RMT_RECV_FUNC_IN_IRAM
+  resumeReceive();
+#endif
+
+  auto const symbols = Symbols(m_buffers + event.buffer * BUFFER_SIZE, event.size);
+
+  Time duration = 0;
+  for (auto const& symbol : symbols) {
+    duration += symbol.duration0 + symbol.duration1;
+  }
+
+  return Capture{
+      .symbols   = symbols,
+      .timestamp = event.timestamp - FRAME_END_US - duration,
+  };
+}
+
+auto RmtReceiver::armWakeup(TaskHandle_t const task) -> bool {
+  if (not isEnabled()) {
+    return true;
+  }
+
+  resumeReceive();
+
+  m_wakeupTask = task;
+
+  if (uxQueueMessagesWaiting(m_events) > 0) {
+    m_wakeupTask = nullptr;
+    return false;
+  }
+
+  return true;
+}
+
+auto IRAM_ATTR RmtReceiver::onReceiveDone(rmt_channel_handle_t const, rmt_rx_done_event_data_t const* const data, void* const context) -> bool {
+  auto* const receiver = static_cast<RmtReceiver*>(context);
+
+  Event const event = {
+      .buffer    = receiver->m_activeBuffer,
+      .size      = data->num_symbols,
+      .timestamp = esp_timer_get_time(),
+  };
+
+  BaseType_t isTaskWoken = pdFALSE;
+  xQueueSendFromISR(receiver->m_events, &event, &isTaskWoken);
+
+  auto const wakeupTask = receiver->m_wakeupTask.exchange(nullptr);
+  if (wakeupTask != nullptr) {
+    vTaskNotifyGiveFromISR(wakeupTask, &isTaskWoken);
+  }
+
+#ifdef CONFIG_RMT_RECV_FUNC_IN_IRAM
+  std::optional<Size> nextBuffer = std::nullopt;
+
+  portENTER_CRITICAL_ISR(&receiver->m_lock);
+  for (Size buffer = 0; buffer < BUFFER_COUNT; ++buffer) {
+    auto const mask = 1U << buffer;
+    if (receiver->m_freeBuffers & mask) {
+      receiver->m_freeBuffers &= ~mask;
+      nextBuffer = buffer;
+      break;
+    }
+  }
+  receiver->m_isReceiveStalled = not nextBuffer.has_value();
+  portEXIT_CRITICAL_ISR(&receiver->m_lock);
+
+  // No logging in the ISR, the stalled capture is retried and reported by the task
+  if (nextBuffer and not receiver->startReceive(*nextBuffer)) {
+    portENTER_CRITICAL_ISR(&receiver->m_lock);
+    receiver->m_freeBuffers |= 1U << *nextBuffer;
+    receiver->m_isReceiveStalled = true;
+    portEXIT_CRITICAL_ISR(&receiver->m_lock);
+  }
+#else
+  // rmt_receive() is in flash, the woken task restarts the capture
+  portENTER_CRITICAL_ISR(&receiver->m_lock);
+  receiver->m_isReceiveStalled = true;
+  portEXIT_CRITICAL_ISR(&receiver->m_lock);
+#endif
+
+  return isTaskWoken == pdTRUE;
+}
+
+auto IRAM_ATTR RmtReceiver::startReceive(Size const buffer) -> bool {
+  m_activeBuffer = buffer;
+
+  auto const result = rmt_receive(m_channel, m_buffers + buffer * BUFFER_SIZE, BUFFER_SIZE * sizeof(rmt_symbol_word_t), &RECEIVE_CONFIGURATION);
+  return result == ESP_OK;
+}
+
+auto RmtReceiver::resumeReceive() -> void {
+  std::optional<Size> nextBuffer = std::nullopt;
+
+  portENTER_CRITICAL(&m_lock);
+  if (m_isReceiveStalled) {
+    for (Size buffer = 0; buffer < BUFFER_COUNT; ++buffer) {
+      auto const mask = 1U << buffer;
+      if (m_freeBuffers & mask) {
+        m_freeBuffers &= ~mask;
+        nextBuffer = buffer;
+        break;
+      }
+    }
+
+    m_isReceiveStalled = not nextBuffer.has_value();
+  }
+  portEXIT_CRITICAL(&m_lock);
+
+  if (nextBuffer) {
+    restartReceive(*nextBuffer);
+  }
+}
+
+auto RmtReceiver::restartReceive(Size const buffer) -> void {
+  auto const isStarted = startReceive(buffer);
+  if (isStarted) {
+    return;
+  }
+
+  ESP_LOGE(TAG, "Failed to restart RMT capture");
+
+  portENTER_CRITICAL(&m_lock);
+  m_freeBuffers |= 1U << buffer;
+  m_isReceiveStalled = true;
+  portEXIT_CRITICAL(&m_lock);
+}
+
+auto RmtReceiver::releaseBuffer(Size const buffer) -> void {
+  auto const mask = 1U << buffer;
+
+  portENTER_CRITICAL(&m_lock);
+  auto const isStalled = m_isReceiveStalled;
+  if (isStalled) {
+    m_freeBuffers &= ~mask;
+    m_isReceiveStalled = false;
+  } else {
+    m_freeBuffers |= mask;
+  }
+  portEXIT_CRITICAL(&m_lock);
+
+  if (isStalled) {
+    restartReceive(buffer);
+  }
+}
+
+} // namespace iebus
@@ -0,0 +1,212 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/RmtTransmitter.hpp"
+
+#include <driver/rmt_tx.h>
+#include <esp_attr.h>
+#include <esp_log.h>
+#include <soc/soc_caps.h>
+
+#include "protocol.hpp"
+
+namespace iebus {
+
+namespace {
+
+auto constexpr TAG = "IEBusRmtTransmitter";
+
+auto constexpr RESOLUTION_HZ       = 1'000'000;
+auto constexpr TRANSMIT_TIMEOUT_MS = MAX_FRAME_BIT_SIZE * DATA_BIT_TOTAL_US / 1'000 + 50;
+
+auto constexpr makeSymbol(auto const highUs, auto const lowUs) -> rmt_symbol_word_t {
+  rmt_symbol_word_t symbol = {};
+
+  symbol.duration0 = highUs;
+  symbol.level0    = 1;
+  symbol.duration1 = lowUs;
+  symbol.level1    = 0;
+
+  return symbol;
+}
+
+auto IRAM_ATTR encodeSymbols(void const* const data, size_t const dataSize, size_t const symbolsWritten, size_t const symbolsFree, rmt_symbol_word_t* const symbols,
+                             bool* const done, void* const context) -> size_t {
+  auto const* const frameSymbols = static_cast<Symbol const*>(data);
+  auto const* const waveforms    = static_cast<rmt_symbol_word_t const*>(context);
+
+  size_t count = 0;
+  while (count < symbolsFree and symbolsWritten + count < dataSize) {
+    auto const symbol = frameSymbols[symbolsWritten + count];
+
+    symbols[count] = waveforms[static_cast<std::uint8_t>(symbol)];
+    count++;
+  }
+
+  *done = symbolsWritten + count >= dataSize;
+
+  return count;
+}
+
+rmt_transmit_config_t constexpr TRANSMIT_CONFIGURATION = {
+    .loop_count = 0,
+    .flags =
+        {
+            .eot_level         = 0,
+            .queue_nonblocking = 0,
+        },
+};
+
+} // namespace
+
+RmtTransmitter::RmtTransmitter(RmtTransmitter::Pin const tx) noexcept : m_txPin(tx) {
+  setBitTiming(DATA_BIT_0_HIGH_US, DATA_BIT_1_HIGH_US);
+}
+
+RmtTransmitter::~RmtTransmitter() {
+  disable();
+}
+
+auto RmtTransmitter::isEnabled() const -> bool {
+  return m_channel != nullptr;
+}
+
+auto RmtTransmitter::setBitTiming(std::uint32_t const bit0HighUS, std::uint32_t const bit1HighUS) -> void {
+  m_waveforms = {
+      makeSymbol(START_BIT_HIGH_US, START_BIT_LOW_US),
+      makeSymbol(bit0HighUS, DATA_BIT_TOTAL_US - bit0HighUS),
+      makeSymbol(bit1HighUS, DATA_BIT_TOTAL_US - bit1HighUS),
+      makeSymbol(bit1HighUS, DATA_BIT_TOTAL_US - bit1HighUS),
+  };
+}
+
+auto RmtTransmitter::enable() -> bool {
+  if (isEnabled()) {
+    return true;
+  }
+
+  m_done = xSemaphoreCreateBinary();
+  if (m_done == nullptr) {
+    ESP_LOGE(TAG, "Failed to allocate completion semaphore");
+    return false;
+  }
+
+  rmt_tx_channel_config_t const channelConfiguration = {
+      .gpio_num          = static_cast<gpio_num_t>(m_txPin),
+      .clk_src           = RMT_CLK_SRC_DEFAULT,
+      .resolution_hz     = RESOLUTION_HZ,
+      .mem_block_symbols = SOC_RMT_MEM_WORDS_PER_CHANNEL,
+      .trans_queue_depth = 1,
+      .intr_priority     = 0,
+      .flags             = {},
+  };
+
+  auto result = rmt_new_tx_channel(&channelConfiguration, &m_channel);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to create RMT channel: %s", esp_err_to_name(result));
+    m_channel = nullptr;
+    disable();
+    return false;
+  }
+
+  rmt_simple_encoder_config_t const encoderConfiguration = {
+      .callback       = encodeSymbols,
+      .arg            = m_waveforms.data(),
+      .min_chunk_size = 1,
+  };
+
+  result = rmt_new_simple_encoder(&encoderConfiguration, &m_encoder);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to create RMT encoder: %s", esp_err_to_name(result));
+    m_encoder = nullptr;
+    disable();
+    return false;
+  }
+
+  rmt_tx_event_callbacks_t const callbacks = {
+      .on_trans_done = onTransmitDone,
+  };
+
+  result = rmt_tx_register_event_callbacks(m_channel, &callbacks, this);
+  if (result == ESP_OK) {
+    result = rmt_enable(m_channel);
+  }
+
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to enable RMT channel: %s", esp_err_to_name(result));
+    disable();
+    return false;
+  }
+
+  return true;
+}
+
+auto RmtTransmitter::disable() -> void {
+  if (m_channel != nullptr) {
+    rmt_disable(m_channel);
+    rmt_del_channel(m_channel);
+    m_channel = nullptr;
+  }
+
+  if (m_encoder != nullptr) {
+    rmt_del_encoder(m_encoder);
+    m_encoder = nullptr;
+  }
+
+  if (m_done != nullptr) {
+    vSemaphoreDelete(m_done);
+    m_done = nullptr;
+  }
+}
+
+auto RmtTransmitter::transmit(Frame::Symbols const symbols) -> bool {
+  if (not isEnabled()) {
+    return false;
+  }
+
+  if (symbols.empty()) {
+    return true;
+  }
+
+  xSemaphoreTake(m_done, 0);
+
+  auto const result = rmt_transmit(m_channel, m_encoder, symbols.data(), symbols.size_bytes(), &TRANSMIT_CONFIGURATION);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to start transmission: %s", esp_err_to_name(result));
+    return false;
+  }
+
+  auto const isDone = xSemaphoreTake(m_done, pdMS_TO_TICKS(TRANSMIT_TIMEOUT_MS)) == pdTRUE;
+  if (not isDone) {
+    ESP_LOGE(TAG, "Transmission timeout");
+    return false;
+  }
+
+  return true;
+}
+
+auto IRAM_ATTR RmtTransmitter::onTransmitDone(rmt_channel_handle_t const, rmt_tx_done_event_data_t const* const, void* const context) -> bool {
+  auto* const transmitter = static_cast<RmtTransmitter*>(context);
+
+  BaseType_t isTaskWoken = pdFALSE;
+  xSemaphoreGiveFromISR(transmitter->m_done, &isTaskWoken);
+
+  return isTaskWoken == pdTRUE;
+}
+
+} // namespace iebus
@@ -0,0 +1,132 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/Segmentation.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace iebus {
+
+Reassembler::Reassembler(std::span<Byte> const buffer) noexcept : m_buffer(buffer) {
+}
+
+auto Reassembler::isComplete() const -> bool {
+  return m_segmentCount > 0 and m_receivedSegments.count() == m_segmentCount;
+}
+
+auto Reassembler::getData() const -> std::span<Byte const> {
+  if (not isComplete()) {
+    return {};
+  }
+
+  return m_buffer.first(m_size);
+}
+
+auto Reassembler::getSegmentBuffer() const -> std::span<Byte> {
+  if (not m_pendingIndex) {
+    return {};
+  }
+
+  return m_buffer.subspan(*m_pendingIndex * SEGMENT_PAYLOAD_SIZE, m_pendingSize);
+}
+
+auto Reassembler::accept(Message const& message) -> Status {
+  if (message.dataLength < SEGMENT_HEADER_SIZE or message.dataLength > MAX_MESSAGE_SIZE) {
+    return Status::INVALID;
+  }
+
+  auto const data    = std::span(message.data);
+  auto const payload = data.subspan(SEGMENT_HEADER_SIZE, message.dataLength - SEGMENT_HEADER_SIZE);
+
+  auto const status = prepare(message.master, data.first<SEGMENT_HEADER_SIZE>(), payload.size());
+  if (status != Status::IN_PROGRESS) {
+    return status;
+  }
+
+  std::copy(payload.begin(), payload.end(), getSegmentBuffer().begin());
+
+  return commit();
+}
+
+auto Reassembler::prepare(Address const master, std::span<Byte const, SEGMENT_HEADER_SIZE> const header, Size const payloadSize) -> Status {
+  m_pendingIndex = std::nullopt;
+
+  auto const index        = static_cast<Size>(header[0]);
+  auto const segmentCount = static_cast<Size>(header[1]) + 1;
+  auto const isLast       = index + 1 == segmentCount;
+
+  if (index >= segmentCount or payloadSize > SEGMENT_PAYLOAD_SIZE) {
+    return Status::INVALID;
+  }
+
+  if (not isLast and payloadSize != SEGMENT_PAYLOAD_SIZE) {
+    return Status::INVALID;
+  }
+
+  auto const isNewTransfer = segmentCount != m_segmentCount or master != m_master or isComplete();
+  if (isNewTransfer) {
+    reset();
+
+    m_segmentCount = segmentCount;
+    m_master       = master;
+  }
+
+  auto const offset = index * SEGMENT_PAYLOAD_SIZE;
+  if (offset + payloadSize > m_buffer.size()) {
+    return Status::BUFFER_OVERFLOW;
+  }
+
+  m_receivedSegments[index] = false;
+
+  m_pendingIndex = index;
+  m_pendingSize  = payloadSize;
+
+  return Status::IN_PROGRESS;
+}
+
+auto Reassembler::commit() -> Status {
+  if (not m_pendingIndex) {
+    return Status::INVALID;
+  }
+
+  auto const index  = *std::exchange(m_pendingIndex, std::nullopt);
+  auto const isLast = index + 1 == m_segmentCount;
+
+  m_receivedSegments[index] = true;
+
+  if (isLast) {
+    m_size = index * SEGMENT_PAYLOAD_SIZE + m_pendingSize;
+  }
+
+  if (not isComplete()) {
+    return Status::IN_PROGRESS;
+  }
+
+  return Status::COMPLETE;
+}
+
+auto Reassembler::reset() -> void {
+  m_receivedSegments.reset();
+  m_segmentCount = 0;
+  m_size         = 0;
+  m_master       = 0;
+  m_pendingIndex = std::nullopt;
+}
+
+} // namespace iebus
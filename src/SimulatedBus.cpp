@@ -0,0 +1,167 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#include "iebus/SimulatedBus.hpp"
+
+#include <algorithm>
+
+#include "protocol.hpp"
+
+namespace iebus {
+
+namespace {
+
+/**
+ * Gap after the last pulse, longer than the longest in-frame gap of the driver
+ */
+auto constexpr BUS_IDLE_US = START_BIT_TOTAL_US;
+
+} // namespace
+
+auto SimulatedBus::makeTrace(Frame::Symbols const symbols, Time const startTime, bool const isAcknowledged, std::span<Pulse> const trace) -> Size {
+  auto const count = std::min(symbols.size(), trace.size());
+  auto timestamp   = startTime;
+
+  for (Size i = 0; i < count; ++i) {
+    trace[i] = makePulse(symbols[i], timestamp, isAcknowledged);
+    timestamp += getSymbolTime(symbols[i]);
+  }
+
+  return count;
+}
+
+auto SimulatedBus::getTime() const -> Time {
+  return m_time;
+}
+
+auto SimulatedBus::isBusFree() const -> bool {
+  return m_isEnabled;
+}
+
+auto SimulatedBus::isFinished() const -> bool {
+  return m_echoIndex >= m_echoSize and m_traceIndex >= m_trace.size();
+}
+
+auto SimulatedBus::load(std::span<Pulse const> const trace) -> void {
+  m_trace       = trace;
+  m_traceIndex  = 0;
+  m_traceOffset = 0;
+}
+
+auto SimulatedBus::setAcknowledgment(bool const isAcknowledged) -> void {
+  m_isAcknowledged = isAcknowledged;
+}
+
+auto SimulatedBus::failTransmission(Size const index) -> void {
+  m_failedTransmission = m_transmissionCount + index;
+}
+
+auto SimulatedBus::enable() -> bool {
+  m_isEnabled = true;
+  return true;
+}
+
+auto SimulatedBus::disable() -> void {
+  m_isEnabled = false;
+  m_echoSize  = 0;
+  m_echoIndex = 0;
+}
+
+auto SimulatedBus::receive(Time const) -> std::optional<Pulse> {
+  if (not m_isEnabled) {
+    return std::nullopt;
+  }
+
+  if (m_echoIndex < m_echoSize) {
+    auto const symbol = m_echo[m_echoIndex++];
+    auto const pulse  = makePulse(symbol, m_echoTime, m_isEchoAcknowledged);
+
+    m_echoTime += getSymbolTime(symbol);
+
+    advance(pulse);
+    return pulse;
+  }
+
+  if (m_traceIndex < m_trace.size()) {
+    auto pulse = m_trace[m_traceIndex++];
+    pulse.timestamp += m_traceOffset;
+
+    advance(pulse);
+    return pulse;
+  }
+
+  return std::nullopt;
+}
+
+auto SimulatedBus::transmit(Frame::Symbols const symbols) -> bool {
+  if (not m_isEnabled) {
+    return false;
+  }
+
+  m_echoSize           = std::min(symbols.size(), m_echo.size());
+  m_echoIndex          = 0;
+  m_echoTime           = m_time;
+  m_isEchoAcknowledged = m_isAcknowledged and m_transmissionCount != m_failedTransmission;
+
+  m_transmissionCount += 1;
+
+  Time duration = 0;
+  for (Size i = 0; i < m_echoSize; ++i) {
+    m_echo[i] = symbols[i];
+    duration += getSymbolTime(symbols[i]);
+  }
+
+  if (m_traceIndex < m_trace.size()) {
+    auto const nextTimestamp = m_trace[m_traceIndex].timestamp + m_traceOffset;
+    auto const shift         = m_time + duration + BUS_IDLE_US - nextTimestamp;
+
+    if (shift > 0) {
+      m_traceOffset += shift;
+    }
+  }
+
+  return true;
+}
+
+auto SimulatedBus::makePulse(Symbol const symbol, Time const timestamp, bool const isAcknowledged) -> Pulse {
+  switch (symbol) {
+  case Symbol::START_BIT:
+    return {.timestamp = timestamp, .highTime = START_BIT_HIGH_US};
+  case Symbol::BIT_0:
+    return {.timestamp = timestamp, .highTime = DATA_BIT_0_HIGH_US};
+  case Symbol::BIT_1:
+    return {.timestamp = timestamp, .highTime = DATA_BIT_1_HIGH_US};
+  case Symbol::ACK_SLOT:
+    return {.timestamp = timestamp, .highTime = isAcknowledged ? DATA_BIT_0_HIGH_US : DATA_BIT_1_HIGH_US};
+  }
+
+  return {.timestamp = timestamp, .highTime = DATA_BIT_1_HIGH_US};
+}
+
+auto SimulatedBus::getSymbolTime(Symbol const symbol) -> Time {
+  if (symbol == Symbol::START_BIT) {
+    return START_BIT_TOTAL_US;
+  }
+
+  return DATA_BIT_TOTAL_US;
+}
+
+auto SimulatedBus::advance(Pulse const& pulse) -> void {
+  m_time = std::max(m_time, pulse.timestamp + pulse.highTime + BUS_IDLE_US);
+}
+
+} // namespace iebus
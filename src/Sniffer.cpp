@@ -0,0 +1,161 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+#include "iebus/Sniffer.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+namespace iebus {
+
+namespace {
+
+static_assert(sizeof(Sniffer::RecordHeader) == 16 and std::is_trivially_copyable_v<Sniffer::RecordHeader>, "Record header has to match the stream layout");
+
+auto setBit(std::span<Byte> const bitmap, Size const index) -> void {
+  bitmap[index / 8] |= static_cast<Byte>(1U << (index % 8));
+}
+
+} // namespace
+
+auto Sniffer::getSize() const -> Size {
+  return m_buffer.getSize();
+}
+
+auto Sniffer::getLostCount() const -> std::uint32_t {
+  return m_lostCount.load(std::memory_order_relaxed);
+}
+
+auto Sniffer::read(std::span<Byte> const buffer, TickType_t const timeout) -> Size {
+  auto count = m_buffer.pop(buffer);
+  if (count > 0 or timeout == 0) {
+    return count;
+  }
+
+  ulTaskNotifyTake(pdTRUE, 0);
+  m_waitingTask = xTaskGetCurrentTaskHandle();
+
+  if (m_buffer.isEmpty()) {
+    ulTaskNotifyTake(pdTRUE, timeout);
+  }
+
+  auto const waitingTask = m_waitingTask.exchange(nullptr);
+  if (waitingTask == nullptr) {
+    ulTaskNotifyTake(pdTRUE, 0);
+  }
+
+  count = m_buffer.pop(buffer);
+
+  return count;
+}
+
+auto Sniffer::beginRecord(Time const timestamp, bool const isTransmitted) -> void {
+  m_header = {
+      .size       = 0,
+      .fieldCount = 0,
+      .timestamp  = static_cast<std::uint32_t>(timestamp),
+      .master     = 0,
+      .slave      = 0,
+      .control    = 0,
+      .dataLength = 0,
+      .flags      = static_cast<std::uint8_t>(isTransmitted ? FLAG_TRANSMITTED : 0),
+      .reserved   = 0,
+  };
+
+  m_acknowledgmentBitmap.fill(0);
+  m_parityErrorBitmap.fill(0);
+}
+
+auto Sniffer::addField(Data const value, bool const isParityValid, bool const isAcknowledged) -> void {
+  Size const index = m_header.fieldCount;
+  if (index >= MAX_FIELD_COUNT) {
+    return;
+  }
+
+  switch (index) {
+  case 0:
+    m_header.flags |= value == static_cast<Data>(BroadcastType::BROADCAST) ? FLAG_BROADCAST : 0;
+    break;
+  case 1:
+    m_header.master = static_cast<std::uint16_t>(value);
+    break;
+  case 2:
+    m_header.slave = static_cast<std::uint16_t>(value);
+    break;
+  case 3:
+    m_header.control = static_cast<std::uint8_t>(value);
+    break;
+  case 4:
+    m_header.dataLength = static_cast<std::uint8_t>(value);
+    break;
+  default:
+    m_data[index - HEADER_FIELD_COUNT] = static_cast<Byte>(value);
+    break;
+  }
+
+  if (isAcknowledged) {
+    setBit(m_acknowledgmentBitmap, index);
+  }
+
+  if (not isParityValid) {
+    setBit(m_parityErrorBitmap, index);
+  }
+
+  m_header.fieldCount++;
+
+  Size const dataLength = m_header.dataLength == 0 ? MAX_MESSAGE_SIZE : m_header.dataLength;
+  if (m_header.fieldCount == HEADER_FIELD_COUNT + dataLength) {
+    m_header.flags |= FLAG_COMPLETE;
+  }
+}
+
+auto Sniffer::commitRecord() -> bool {
+  Size const fieldCount = m_header.fieldCount;
+  auto const dataSize   = fieldCount > HEADER_FIELD_COUNT ? fieldCount - HEADER_FIELD_COUNT : 0;
+  auto const bitmapSize = (fieldCount + 7) / 8;
+  auto const recordSize = sizeof(RecordHeader) + dataSize + bitmapSize * 2;
+
+  m_header.size = static_cast<std::uint16_t>(recordSize);
+
+  auto* position = m_record.data();
+
+  std::memcpy(position, &m_header, sizeof(RecordHeader));
+  position += sizeof(RecordHeader);
+
+  std::memcpy(position, m_data.data(), dataSize);
+  position += dataSize;
+
+  std::memcpy(position, m_acknowledgmentBitmap.data(), bitmapSize);
+  position += bitmapSize;
+
+  std::memcpy(position, m_parityErrorBitmap.data(), bitmapSize);
+
+  auto const isPushed = m_buffer.push(std::span<Byte const>(m_record).first(recordSize));
+  if (not isPushed) {
+    m_lostCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  auto const waitingTask = m_waitingTask.exchange(nullptr);
+  if (waitingTask != nullptr) {
+    xTaskNotifyGive(waitingTask);
+  }
+
+  return true;
+}
+
+} // namespace iebus
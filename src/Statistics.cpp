@@ -0,0 +1,179 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/Statistics.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace iebus {
+
+namespace {
+
+auto constexpr NO_MINIMUM = std::numeric_limits<std::uint32_t>::max();
+
+auto toValue(Time const time) -> std::uint32_t {
+  auto const clamped = std::clamp<Time>(time, 0, NO_MINIMUM - 1);
+  return static_cast<std::uint32_t>(clamped);
+}
+
+template <typename T, Size N> auto load(std::array<std::atomic<T>, N> const& source) -> std::array<T, N> {
+  std::array<T, N> values = {};
+
+  for (Size i = 0; i < N; ++i) {
+    values[i] = source[i].load(std::memory_order_relaxed);
+  }
+
+  return values;
+}
+
+template <typename T, Size N> auto clear(std::array<std::atomic<T>, N>& values) -> void {
+  for (auto& value : values) {
+    value.store(0, std::memory_order_relaxed);
+  }
+}
+
+} // namespace
+
+Statistics::Statistics() noexcept {
+  resetRange(m_highTime);
+  resetRange(m_latency);
+}
+
+auto Statistics::getSnapshot() const -> Snapshot {
+  return {
+      .framesReceived       = m_framesReceived.load(std::memory_order_relaxed),
+      .framesSent           = m_framesSent.load(std::memory_order_relaxed),
+      .parityErrors         = load(m_parityErrors),
+      .nakCount             = m_nakCount.load(std::memory_order_relaxed),
+      .arbitrationLostCount = m_arbitrationLostCount.load(std::memory_order_relaxed),
+      .startBitRejectCount  = m_startBitRejectCount.load(std::memory_order_relaxed),
+      .wakeupMissCount      = m_wakeupMissCount.load(std::memory_order_relaxed),
+      .queueOverflowCount   = m_queueOverflowCount.load(std::memory_order_relaxed),
+      .forwardDropCount     = m_forwardDropCount.load(std::memory_order_relaxed),
+      .highTimeMinUS        = getMin(m_highTime),
+      .highTimeMaxUS        = m_highTime.max.load(std::memory_order_relaxed),
+      .highTimeHistogram    = load(m_highTimeHistogram),
+      .latencyMinUS         = getMin(m_latency),
+      .latencyMaxUS         = m_latency.max.load(std::memory_order_relaxed),
+      .latencyHistogram     = load(m_latencyHistogram),
+  };
+}
+
+auto Statistics::countFrameReceived() -> void {
+  increment(m_framesReceived);
+}
+
+auto Statistics::countFrameSent() -> void {
+  increment(m_framesSent);
+}
+
+auto Statistics::countParityError(FrameField const field) -> void {
+  auto const index = static_cast<Size>(field);
+  if (index >= FIELD_COUNT) {
+    return;
+  }
+
+  increment(m_parityErrors[index]);
+}
+
+auto Statistics::countNak() -> void {
+  increment(m_nakCount);
+}
+
+auto Statistics::countArbitrationLost() -> void {
+  increment(m_arbitrationLostCount);
+}
+
+auto Statistics::countStartBitReject() -> void {
+  increment(m_startBitRejectCount);
+}
+
+auto Statistics::countWakeupMiss() -> void {
+  increment(m_wakeupMissCount);
+}
+
+auto Statistics::countQueueOverflow() -> void {
+  increment(m_queueOverflowCount);
+}
+
+auto Statistics::countForwardDrop() -> void {
+  increment(m_forwardDropCount);
+}
+
+auto Statistics::recordHighTime(Time const highTime) -> void {
+  auto const value = toValue(highTime);
+  auto const bin   = std::min<Size>(value / HIGH_TIME_BIN_US, HIGH_TIME_BIN_COUNT - 1);
+
+  record(m_highTime, value);
+  increment(m_highTimeHistogram[bin]);
+}
+
+auto Statistics::recordLatency(Time const latency) -> void {
+  auto const value = toValue(latency);
+  auto const bin   = std::min<Size>(std::bit_width(value), LATENCY_BIN_COUNT - 1);
+
+  record(m_latency, value);
+  increment(m_latencyHistogram[bin]);
+}
+
+auto Statistics::reset() -> void {
+  m_framesReceived.store(0, std::memory_order_relaxed);
+  m_framesSent.store(0, std::memory_order_relaxed);
+  clear(m_parityErrors);
+  m_nakCount.store(0, std::memory_order_relaxed);
+  m_arbitrationLostCount.store(0, std::memory_order_relaxed);
+  m_startBitRejectCount.store(0, std::memory_order_relaxed);
+  m_wakeupMissCount.store(0, std::memory_order_relaxed);
+  m_queueOverflowCount.store(0, std::memory_order_relaxed);
+  m_forwardDropCount.store(0, std::memory_order_relaxed);
+
+  resetRange(m_highTime);
+  clear(m_highTimeHistogram);
+
+  resetRange(m_latency);
+  clear(m_latencyHistogram);
+}
+
+auto Statistics::increment(std::atomic<std::uint32_t>& counter) -> void {
+  counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+auto Statistics::record(Range& range, std::uint32_t const value) -> void {
+  // Single writer, so plain loads and stores are enough and avoid a compare-exchange loop per bit
+  if (value < range.min.load(std::memory_order_relaxed)) {
+    range.min.store(value, std::memory_order_relaxed);
+  }
+
+  if (value > range.max.load(std::memory_order_relaxed)) {
+    range.max.store(value, std::memory_order_relaxed);
+  }
+}
+
+auto Statistics::resetRange(Range& range) -> void {
+  range.min.store(NO_MINIMUM, std::memory_order_relaxed);
+  range.max.store(0, std::memory_order_relaxed);
+}
+
+auto Statistics::getMin(Range const& range) -> std::uint32_t {
+  auto const value = range.min.load(std::memory_order_relaxed);
+  return value == NO_MINIMUM ? 0 : value;
+}
+
+} // namespace iebus
@@ -0,0 +1,200 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include "iebus/TransmitScheduler.hpp"
+
+#include <cstdint>
+#include <freertos/task.h>
+#include <utility>
+
+namespace iebus {
+
+namespace {
+
+/**
+ * Backoff stops doubling after this number of retries
+ */
+auto constexpr MAX_BACKOFF_SHIFT = 6;
+
+} // namespace
+
+TransmitScheduler::TransmitScheduler() noexcept : m_lock(xSemaphoreCreateMutexStatic(&m_lockBuffer)) {
+}
+
+auto TransmitScheduler::push(MessagePool::Handle message, Options const& options) -> bool {
+  auto const now = xTaskGetTickCount();
+
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+
+  for (auto& entry : m_entries) {
+    if (entry.isUsed) {
+      continue;
+    }
+
+    entry = {
+        .message   = std::move(message),
+        .options   = options,
+        .attempt   = 0,
+        .readyTime = now,
+        .deadline  = now + options.timeout,
+        .sequence  = m_sequence++,
+        .isUsed    = true,
+    };
+
+    xSemaphoreGive(m_lock);
+    return true;
+  }
+
+  xSemaphoreGive(m_lock);
+  return false;
+}
+
+auto TransmitScheduler::expire(TickType_t const now) -> void {
+  for (Size i = 0; i < m_entries.size(); ++i) {
+    xSemaphoreTake(m_lock, portMAX_DELAY);
+    auto const& entry    = m_entries[i];
+    auto const isExpired = entry.isUsed and entry.options.timeout != portMAX_DELAY and isReached(now, entry.deadline);
+    xSemaphoreGive(m_lock);
+
+    if (isExpired) {
+      finish(i, TransmitStatus::EXPIRED);
+    }
+  }
+}
+
+auto TransmitScheduler::next(TickType_t const now) -> std::optional<Size> {
+  std::optional<Size> result = std::nullopt;
+
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+
+  for (Size i = 0; i < m_entries.size(); ++i) {
+    auto const& entry = m_entries[i];
+    if (not entry.isUsed or not isReached(now, entry.readyTime)) {
+      continue;
+    }
+
+    if (not result) {
+      result = i;
+      continue;
+    }
+
+    auto const& best = m_entries[*result];
+
+    auto const isHigherPriority = entry.options.priority > best.options.priority;
+    auto const isSamePriority   = entry.options.priority == best.options.priority;
+    auto const isOlder          = static_cast<std::int32_t>(entry.sequence - best.sequence) < 0;
+
+    if (isHigherPriority or (isSamePriority and isOlder)) {
+      result = i;
+    }
+  }
+
+  xSemaphoreGive(m_lock);
+
+  return result;
+}
+
+auto TransmitScheduler::getMessage(Size const index) const -> Message const& {
+  return *m_entries[index].message;
+}
+
+auto TransmitScheduler::complete(Size const index, bool const isSent, TickType_t const now) -> void {
+  if (isSent) {
+    return finish(index, TransmitStatus::SENT);
+  }
+
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+
+  auto& entry = m_entries[index];
+
+  auto const isExhausted = entry.attempt >= entry.options.retryCount;
+  if (not isExhausted) {
+    auto const shift = entry.attempt < MAX_BACKOFF_SHIFT ? entry.attempt : MAX_BACKOFF_SHIFT;
+
+    entry.readyTime = now + (entry.options.backoff << shift);
+    entry.attempt += 1;
+  }
+
+  xSemaphoreGive(m_lock);
+
+  if (isExhausted) {
+    finish(index, TransmitStatus::FAILED);
+  }
+}
+
+auto TransmitScheduler::getWaitTime(TickType_t const now) -> TickType_t {
+  TickType_t result = portMAX_DELAY;
+
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+
+  for (auto const& entry : m_entries) {
+    if (not entry.isUsed) {
+      continue;
+    }
+
+    if (isReached(now, entry.readyTime)) {
+      result = 0;
+      break;
+    }
+
+    auto const waitTime = entry.readyTime - now;
+    if (waitTime < result) {
+      result = waitTime;
+    }
+  }
+
+  xSemaphoreGive(m_lock);
+
+  return result;
+}
+
+auto TransmitScheduler::cancel() -> void {
+  for (Size i = 0; i < m_entries.size(); ++i) {
+    xSemaphoreTake(m_lock, portMAX_DELAY);
+    auto const isUsed = m_entries[i].isUsed;
+    xSemaphoreGive(m_lock);
+
+    if (isUsed) {
+      finish(i, TransmitStatus::CANCELLED);
+    }
+  }
+}
+
+auto TransmitScheduler::isReached(TickType_t const now, TickType_t const time) -> bool {
+  return static_cast<std::int32_t>(now - time) >= 0;
+}
+
+auto TransmitScheduler::finish(Size const index, TransmitStatus const status) -> void {
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+
+  auto& entry = m_entries[index];
+
+  auto const callback = entry.options.callback;
+  auto const context  = entry.options.context;
+
+  entry.message.reset();
+  entry.isUsed = false;
+
+  xSemaphoreGive(m_lock);
+
+  if (callback != nullptr) {
+    callback(status, context);
+  }
+}
+
+} // namespace iebus
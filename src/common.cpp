@@ -18,26 +18,68 @@
 
 #include "common.hpp"
 
+#include <esp_attr.h>
+#include <esp_cpu.h>
+#include <esp_rom_sys.h>
 #include <esp_timer.h>
+#include <sdkconfig.h>
 
 namespace iebus {
 
+namespace {
+
+/**
+ * Placed in DRAM so conversions are usable while the flash cache is disabled
+ */
+DRAM_ATTR Cycles cyclesPerUS = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+
+} // namespace
+
+auto calibrateTimebase() -> void {
+  auto const ticksPerUS = esp_rom_get_cpu_ticks_per_us();
+  if (ticksPerUS > 0) {
+    cyclesPerUS = ticksPerUS;
+  }
+}
+
+auto IRAM_ATTR getCycles() -> Cycles {
+  return esp_cpu_get_cycle_count();
+}
+
+auto IRAM_ATTR toCycles(Time const timeUS) -> Cycles {
+  if (timeUS <= 0) {
+    return 0;
+  }
+
+  return static_cast<Cycles>(timeUS) * cyclesPerUS;
+}
+
+auto IRAM_ATTR toTimeUS(Cycles const cycles) -> Time {
+  return (cycles + cyclesPerUS / 2) / cyclesPerUS;
+}
+
+auto IRAM_ATTR isElapsed(Cycles const startCycles, Cycles const durationCycles) -> bool {
+  return getCycles() - startCycles >= durationCycles;
+}
+
+auto isSingleCoreAffinity(BaseType_t const core) -> bool {
+#ifdef CONFIG_FREERTOS_UNICORE
+  static_cast<void>(core);
+  return true;
+#else
+  return core != tskNO_AFFINITY;
+#endif
+}
+
 auto getTimeUS() -> Time {
   return esp_timer_get_time();
 }
 
-auto delayUS(Time const delay) -> void {
-  auto const startTime = getTimeUS();
-
-  bool enable = true;
-  while (enable) {
-    auto const currentTime    = getTimeUS();
-    auto const differenceTime = currentTime - startTime;
-    auto const isTimeOut      = differenceTime >= delay;
+auto IRAM_ATTR delayUS(Time const delay) -> void {
+  auto const startCycles    = getCycles();
+  auto const durationCycles = toCycles(delay);
 
-    if (isTimeOut) {
-      enable = false;
-    }
+  while (not isElapsed(startCycles, durationCycles)) {
   }
 }
 
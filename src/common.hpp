@@ -20,11 +20,63 @@
 
 #include <cstdint>
 
+#include <freertos/FreeRTOS.h>
+
+#include <iebus/Message.hpp>
+
 namespace iebus {
 
-using Time = std::int64_t;
+/**
+ * CPU cycle count of the calling core. Wraps around, so only differences of readings on the same core are meaningful
+ */
+using Cycles = std::uint32_t;
+
+/**
+ * Calibrate cycle conversions to the current CPU clock. Has to be repeated after the CPU frequency is changed
+ */
+auto calibrateTimebase() -> void;
+
+/**
+ * Get CPU cycle count. ISR safe
+ * @return Cycles
+ */
+auto getCycles() -> Cycles;
+/**
+ * Convert microseconds to CPU cycles. ISR safe
+ * @param timeUS Non negative duration, negative values are converted to zero
+ * @return Cycles
+ */
+auto toCycles(Time timeUS) -> Cycles;
+/**
+ * Convert CPU cycles to microseconds rounded to the nearest one. ISR safe
+ * @param cycles Duration
+ * @return Microseconds
+ */
+auto toTimeUS(Cycles cycles) -> Time;
+/**
+ * Check if duration is elapsed since the reading. ISR safe
+ * @param startCycles Reading of getCycles() on the calling core
+ * @param durationCycles Duration below 2^31 cycles
+ * @return bool
+ */
+auto isElapsed(Cycles startCycles, Cycles durationCycles) -> bool;
+
+/**
+ * Check if a task with the core affinity measures cycle intervals on one core, i.e. it is pinned or the chip has a single core
+ * @param core Core affinity
+ * @return bool
+ */
+auto isSingleCoreAffinity(BaseType_t core) -> bool;
 
+/**
+ * Get absolute time shared by all cores and interrupts
+ * @return Microseconds since boot
+ */
 auto getTimeUS() -> Time;
+/**
+ * Busy-wait on the CPU cycle counter. ISR safe
+ * @param delay Microseconds
+ */
 auto delayUS(Time delay) -> void;
 
 } // namespace iebus
@@ -0,0 +1,47 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <iebus/Frame.hpp>
+
+namespace iebus {
+
+auto constexpr START_BIT_TOTAL_US     = 190;
+auto constexpr START_BIT_HIGH_US      = 171;
+auto constexpr START_BIT_LOW_US       = START_BIT_TOTAL_US - START_BIT_HIGH_US;
+auto constexpr START_BIT_THRESHOLD_US = 20;
+auto constexpr START_BIT_MIN_HIGH_US  = START_BIT_HIGH_US - START_BIT_THRESHOLD_US;
+auto constexpr START_BIT_MAX_HIGH_US  = START_BIT_HIGH_US + START_BIT_THRESHOLD_US;
+
+auto constexpr DATA_BIT_TOTAL_US  = 39;
+auto constexpr DATA_BIT_0_HIGH_US = 33;
+auto constexpr DATA_BIT_0_LOW_US  = DATA_BIT_TOTAL_US - DATA_BIT_0_HIGH_US;
+auto constexpr DATA_BIT_1_HIGH_US = 20;
+auto constexpr DATA_BIT_1_LOW_US  = DATA_BIT_TOTAL_US - DATA_BIT_1_HIGH_US;
+
+/**
+ * Bits after the start bit on which masters arbitrate. Bit 0 is dominant
+ */
+auto constexpr ARBITRATION_BIT_SIZE = BROADCAST_BIT_SIZE + MASTER_ADDRESS_BIT_SIZE;
+/**
+ * Nominal decision point between the high times of bit 1 and bit 0, also the arbitration bus sample point
+ */
+auto constexpr DATA_BIT_THRESHOLD_US = (DATA_BIT_1_HIGH_US + DATA_BIT_0_HIGH_US + 1) / 2;
+
+} // namespace iebus
@@ -0,0 +1,92 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <iebus/AcceptanceFilter.hpp>
+
+#include "Check.hpp"
+
+using namespace iebus;
+
+namespace {
+
+auto testEmptyAcceptsAll() -> void {
+  AcceptanceFilter filter;
+
+  IEBUS_CHECK(filter.isEmpty());
+  IEBUS_CHECK(filter.acceptsAddress(0x123, 0x456));
+  IEBUS_CHECK(filter.accepts(0xFFF, 0x000, 0xF));
+}
+
+auto testMasterAndSlave() -> void {
+  AcceptanceFilter filter;
+
+  IEBUS_CHECK(filter.addMaster(0x123));
+  IEBUS_CHECK(filter.addSlave(0x456));
+  IEBUS_CHECK(not filter.isEmpty());
+
+  IEBUS_CHECK(filter.acceptsAddress(0x123, 0x001));
+  IEBUS_CHECK(filter.acceptsAddress(0x001, 0x456));
+  IEBUS_CHECK(not filter.acceptsAddress(0x124, 0x457));
+  IEBUS_CHECK(filter.accepts(0x123, 0x001, 0xA));
+
+  filter.clear();
+  IEBUS_CHECK(filter.isEmpty());
+  IEBUS_CHECK(filter.acceptsAddress(0x124, 0x457));
+}
+
+auto testMaskedRule() -> void {
+  AcceptanceFilter filter;
+
+  IEBUS_CHECK(filter.addRule({
+      .master      = 0x100,
+      .masterMask  = 0xF00,
+      .slave       = 0,
+      .slaveMask   = 0,
+      .control     = 0x8,
+      .controlMask = 0x8,
+  }));
+
+  IEBUS_CHECK(filter.acceptsAddress(0x1AB, 0x456));
+  IEBUS_CHECK(not filter.acceptsAddress(0x2AB, 0x456));
+
+  IEBUS_CHECK(filter.accepts(0x1AB, 0x456, 0xF));
+  IEBUS_CHECK(not filter.accepts(0x1AB, 0x456, 0x7));
+}
+
+auto testCapacity() -> void {
+  AcceptanceFilter filter;
+
+  for (Size i = 0; i < AcceptanceFilter::MAX_RULE_COUNT; ++i) {
+    IEBUS_CHECK(filter.addMaster(static_cast<Address>(i)));
+  }
+
+  IEBUS_CHECK(not filter.addMaster(0x100));
+  IEBUS_CHECK(filter.acceptsAddress(AcceptanceFilter::MAX_RULE_COUNT - 1, 0));
+  IEBUS_CHECK(not filter.acceptsAddress(0x100, 0));
+}
+
+} // namespace
+
+auto main() -> int {
+  testEmptyAcceptsAll();
+  testMasterAndSlave();
+  testMaskedRule();
+  testCapacity();
+
+  return test::getResult();
+}
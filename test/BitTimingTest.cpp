@@ -0,0 +1,107 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <iebus/BitTiming.hpp>
+
+#include "Check.hpp"
+
+using namespace iebus;
+
+namespace {
+
+/**
+ * Enough samples for an update of the learned timing
+ */
+auto constexpr SAMPLE_COUNT = 512;
+
+auto feed(BitTiming& timing, Time const bit1HighUS, Time const bit0HighUS) -> void {
+  for (Size i = 0; i < SAMPLE_COUNT / 2; ++i) {
+    timing.decode(bit1HighUS);
+    timing.decode(bit0HighUS);
+  }
+}
+
+auto testNominal() -> void {
+  BitTiming timing;
+
+  auto const nominal = timing.getTiming();
+  IEBUS_CHECK(nominal.bit1HighUS == 20);
+  IEBUS_CHECK(nominal.bit0HighUS == 33);
+  IEBUS_CHECK(nominal.thresholdUS > nominal.bit1HighUS and nominal.thresholdUS < nominal.bit0HighUS);
+
+  IEBUS_CHECK(timing.classify(nominal.bit1HighUS) == 1);
+  IEBUS_CHECK(timing.classify(nominal.bit0HighUS) == 0);
+  IEBUS_CHECK(timing.classify(nominal.thresholdUS) == 0);
+  IEBUS_CHECK(timing.classify(nominal.thresholdUS - 1) == 1);
+}
+
+auto testFixedTimingIgnoresSamples() -> void {
+  BitTiming timing;
+
+  feed(timing, 23, 36);
+
+  IEBUS_CHECK(not timing.isAdaptive());
+  IEBUS_CHECK(not timing.update());
+  IEBUS_CHECK(timing.getTiming().bit1HighUS == 20);
+}
+
+auto testAdaptation() -> void {
+  BitTiming timing;
+  timing.setAdaptive(true);
+
+  IEBUS_CHECK(not timing.update());
+
+  feed(timing, 23, 36);
+
+  IEBUS_CHECK(timing.update());
+
+  auto const learned = timing.getTiming();
+  IEBUS_CHECK(learned.bit1HighUS == 23);
+  IEBUS_CHECK(learned.bit0HighUS == 36);
+  IEBUS_CHECK(learned.thresholdUS == 30);
+  IEBUS_CHECK(timing.classify(29) == 1);
+  IEBUS_CHECK(timing.classify(30) == 0);
+
+  timing.setAdaptive(false);
+  IEBUS_CHECK(timing.getTiming().bit1HighUS == 20);
+  IEBUS_CHECK(timing.getTiming().bit0HighUS == 33);
+}
+
+auto testDriftIsClamped() -> void {
+  BitTiming timing;
+  timing.setAdaptive(true);
+
+  feed(timing, 2, 60);
+
+  IEBUS_CHECK(timing.update());
+
+  auto const learned = timing.getTiming();
+  IEBUS_CHECK(learned.bit1HighUS == 14);
+  IEBUS_CHECK(learned.bit0HighUS == 39);
+}
+
+} // namespace
+
+auto main() -> int {
+  testNominal();
+  testFixedTimingIgnoresSamples();
+  testAdaptation();
+  testDriftIsClamped();
+
+  return test::getResult();
+}
@@ -0,0 +1,49 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <cstdio>
+
+/**
+ * Minimal assertion helpers of the host tests, a failed check is reported and the test keeps running
+ */
+#define IEBUS_CHECK(condition) iebus::test::check(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+
+namespace iebus::test {
+
+inline auto failureCount = 0;
+
+inline auto check(bool const isPassed, char const* const expression, char const* const file, int const line) -> bool {
+  if (not isPassed) {
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    failureCount += 1;
+  }
+
+  return isPassed;
+}
+
+/**
+ * Get exit code of the test executable
+ * @return Zero if all checks passed
+ */
+inline auto getResult() -> int {
+  return failureCount == 0 ? 0 : 1;
+}
+
+} // namespace iebus::test
@@ -0,0 +1,125 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include <iebus/Dispatcher.hpp>
+
+#include "Check.hpp"
+#include "Fixture.hpp"
+
+using namespace iebus;
+
+namespace {
+
+/**
+ * Handler calls in order, the context is the handler id
+ */
+struct Calls {
+  std::array<int, Dispatcher::MAX_SUBSCRIPTION_COUNT> ids = {};
+  Size count                                              = 0;
+};
+
+Calls calls;
+
+auto record(Message const&, void* const context) -> void {
+  calls.ids[calls.count++] = static_cast<int>(reinterpret_cast<std::intptr_t>(context));
+}
+
+auto makeId(int const id) -> void* {
+  return reinterpret_cast<void*>(static_cast<std::intptr_t>(id));
+}
+
+auto makeMessage(Address const master, Address const slave, Byte const control) -> Message {
+  auto message    = test::makeMessage(BroadcastType::FOR_DEVICE, master, slave, 0);
+  message.control = control;
+  return message;
+}
+
+auto testRouting() -> void {
+  Dispatcher dispatcher;
+
+  IEBUS_CHECK(dispatcher.subscribe(0x123, 0x456, 0xA, record, makeId(1)));
+  IEBUS_CHECK(dispatcher.subscribe(0x123, 0x456, 0xB, record, makeId(2)));
+  IEBUS_CHECK(dispatcher.subscribe(Dispatcher::ANY_ADDRESS, 0x456, Dispatcher::ANY_CONTROL, record, makeId(3)));
+  IEBUS_CHECK(not dispatcher.subscribe(0x123, 0x456, 0xA, nullptr));
+
+  IEBUS_CHECK(dispatcher.dispatch(makeMessage(0x123, 0x456, 0xA)) == 0);
+
+  dispatcher.build();
+  IEBUS_CHECK(dispatcher.isBuilt());
+  IEBUS_CHECK(dispatcher.getSubscriptionCount() == 3);
+  IEBUS_CHECK(not dispatcher.subscribe(0x123, 0x456, 0xC, record));
+
+  calls = {};
+  IEBUS_CHECK(dispatcher.dispatch(makeMessage(0x123, 0x456, 0xA)) == 2);
+  IEBUS_CHECK(calls.ids[0] == 1 and calls.ids[1] == 3);
+
+  calls = {};
+  IEBUS_CHECK(dispatcher.dispatch(makeMessage(0x321, 0x456, 0xC)) == 1);
+  IEBUS_CHECK(calls.ids[0] == 3);
+
+  IEBUS_CHECK(dispatcher.dispatch(makeMessage(0x123, 0x457, 0xA)) == 0);
+}
+
+auto testOrder() -> void {
+  Dispatcher dispatcher;
+
+  auto constexpr ANY_ADDRESS = Dispatcher::ANY_ADDRESS;
+  auto constexpr ANY_CONTROL = Dispatcher::ANY_CONTROL;
+
+  IEBUS_CHECK(dispatcher.subscribe(ANY_ADDRESS, ANY_ADDRESS, ANY_CONTROL, record, makeId(1)));
+  IEBUS_CHECK(dispatcher.subscribe(ANY_ADDRESS, 0x456, 0xA, record, makeId(2)));
+  IEBUS_CHECK(dispatcher.subscribe(0x123, 0x456, ANY_CONTROL, record, makeId(3)));
+  IEBUS_CHECK(dispatcher.subscribe(ANY_ADDRESS, ANY_ADDRESS, 0xA, record, makeId(4)));
+  IEBUS_CHECK(dispatcher.subscribe(0x123, 0x456, 0xA, record, makeId(5)));
+  IEBUS_CHECK(dispatcher.subscribe(ANY_ADDRESS, ANY_ADDRESS, ANY_CONTROL, record, makeId(6)));
+  dispatcher.build();
+
+  calls = {};
+  IEBUS_CHECK(dispatcher.dispatch(makeMessage(0x123, 0x456, 0xA)) == 6);
+
+  std::array<int, 6> const expected = {5, 2, 4, 3, 1, 6};
+  IEBUS_CHECK(std::equal(expected.begin(), expected.end(), calls.ids.begin(), calls.ids.begin() + calls.count));
+}
+
+auto testCapacity() -> void {
+  Dispatcher dispatcher;
+
+  for (Size i = 0; i < Dispatcher::MAX_SUBSCRIPTION_COUNT; ++i) {
+    IEBUS_CHECK(dispatcher.subscribe(static_cast<Address>(i), 0x456, 0xA, record));
+  }
+
+  IEBUS_CHECK(not dispatcher.subscribe(0x100, 0x456, 0xA, record));
+  dispatcher.build();
+
+  IEBUS_CHECK(dispatcher.dispatch(makeMessage(Dispatcher::MAX_SUBSCRIPTION_COUNT - 1, 0x456, 0xA)) == 1);
+  IEBUS_CHECK(dispatcher.dispatch(makeMessage(0x100, 0x456, 0xA)) == 0);
+}
+
+} // namespace
+
+auto main() -> int {
+  testRouting();
+  testOrder();
+  testCapacity();
+
+  return test::getResult();
+}
@@ -0,0 +1,117 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <iebus/Field.hpp>
+#include <iebus/Frame.hpp>
+
+#include "Check.hpp"
+
+using namespace iebus;
+
+namespace {
+
+/**
+ * Reference parity counting the bits one by one
+ */
+auto countParity(Data const data, Size const numBits) -> Bit {
+  Bit parity = 0;
+
+  for (Size i = 0; i < numBits; ++i) {
+    parity ^= static_cast<Bit>(data >> i & 1);
+  }
+
+  return parity;
+}
+
+auto toBit(Symbol const symbol) -> Bit {
+  return symbol == Symbol::BIT_1 ? 1 : 0;
+}
+
+auto testParity() -> void {
+  for (Data data = 0; data < (1U << MASTER_ADDRESS_BIT_SIZE); ++data) {
+    IEBUS_CHECK(MasterAddressField::calculateParity(data) == countParity(data, MASTER_ADDRESS_BIT_SIZE));
+  }
+
+  for (Data data = 0; data < (1U << DATA_BIT_SIZE); ++data) {
+    IEBUS_CHECK(DataField::calculateParity(data) == countParity(data, DATA_BIT_SIZE));
+  }
+
+  IEBUS_CHECK(ControlField::calculateParity(0x1F) == countParity(0x0F, CONTROL_BIT_SIZE));
+  IEBUS_CHECK(DataField::calculateParity(0x1FF) == countParity(0xFF, DATA_BIT_SIZE));
+}
+
+auto testEncode() -> void {
+  Frame frame;
+  frame.clear();
+
+  DataField::encode(0xA5, frame);
+
+  auto const symbols = frame.getSymbols();
+  IEBUS_CHECK(symbols.size() == DATA_BIT_SIZE + PARITY_BIT_SIZE + ACK_BIT_SIZE);
+
+  Data value = 0;
+  for (Size i = 0; i < DATA_BIT_SIZE; ++i) {
+    value = static_cast<Data>(value << 1 | toBit(symbols[i]));
+  }
+
+  IEBUS_CHECK(value == 0xA5);
+  IEBUS_CHECK(toBit(symbols[DATA_BIT_SIZE]) == DataField::calculateParity(0xA5));
+  IEBUS_CHECK(symbols[DATA_BIT_SIZE + 1] == Symbol::ACK_SLOT);
+}
+
+auto testFieldLayout() -> void {
+  Frame frame;
+  frame.clear();
+
+  BroadcastField::encode(1, frame);
+  IEBUS_CHECK(frame.getSymbols().size() == BROADCAST_BIT_SIZE);
+
+  MasterAddressField::encode(0x123, frame);
+  IEBUS_CHECK(frame.getSymbols().size() == BROADCAST_BIT_SIZE + MASTER_ADDRESS_BIT_SIZE + PARITY_BIT_SIZE);
+  IEBUS_CHECK(frame.getSymbols().back() != Symbol::ACK_SLOT);
+
+  SlaveAddressField::encode(0x456, frame);
+  IEBUS_CHECK(frame.getSymbols().back() == Symbol::ACK_SLOT);
+}
+
+auto testFrameCapacity() -> void {
+  Frame frame;
+  frame.clear();
+  frame.appendStartBit();
+
+  for (Size i = 0; i < MAX_FRAME_BIT_SIZE; ++i) {
+    frame.appendBit(1);
+  }
+
+  IEBUS_CHECK(frame.getSymbols().size() == MAX_FRAME_BIT_SIZE);
+  IEBUS_CHECK(frame.getSymbols().front() == Symbol::START_BIT);
+
+  frame.clear();
+  IEBUS_CHECK(frame.getSymbols().empty());
+}
+
+} // namespace
+
+auto main() -> int {
+  testParity();
+  testEncode();
+  testFieldLayout();
+  testFrameCapacity();
+
+  return test::getResult();
+}
@@ -0,0 +1,121 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+
+#include <iebus/Backend.hpp>
+#include <iebus/Field.hpp>
+#include <iebus/Frame.hpp>
+#include <iebus/Message.hpp>
+#include <iebus/SimulatedBus.hpp>
+
+/**
+ * Messages and simulated bus traces shared by the host tests and the benchmark
+ */
+namespace iebus::test {
+
+/**
+ * Make message with control 0xF
+ * @param broadcast Broadcast field
+ * @param master Master address
+ * @param slave Slave address
+ * @param data Data bytes
+ * @return Message
+ */
+inline auto makeMessage(BroadcastType const broadcast, Address const master, Address const slave, std::span<Byte const> const data) -> Message {
+  Message message = {
+      .broadcast  = broadcast,
+      .master     = master,
+      .slave      = slave,
+      .control    = 0xF,
+      .dataLength = data.size(),
+      .data       = {},
+  };
+
+  std::copy(data.begin(), data.end(), message.data.begin());
+  return message;
+}
+
+/**
+ * Make message with control 0xF and the data bytes 0, 1, 2 and so on
+ * @param broadcast Broadcast field
+ * @param master Master address
+ * @param slave Slave address
+ * @param dataLength Number of data bytes
+ * @return Message
+ */
+inline auto makeMessage(BroadcastType const broadcast, Address const master, Address const slave, Size const dataLength) -> Message {
+  auto message       = makeMessage(broadcast, master, slave, std::span<Byte const>());
+  message.dataLength = dataLength;
+
+  for (Size i = 0; i < dataLength; ++i) {
+    message.data[i] = static_cast<Byte>(i);
+  }
+
+  return message;
+}
+
+/**
+ * Encode message into frame symbols the way a remote master sends it
+ * @param message Message
+ * @param frame Destination frame
+ */
+inline auto encode(Message const& message, Frame& frame) -> void {
+  frame.clear();
+  frame.appendStartBit();
+
+  BroadcastField::encode(static_cast<Data>(message.broadcast), frame);
+  MasterAddressField::encode(message.master, frame);
+  SlaveAddressField::encode(message.slave, frame);
+  ControlField::encode(message.control, frame);
+  DataLengthField::encode(static_cast<Data>(message.dataLength), frame);
+
+  for (auto const byte : message.getData()) {
+    DataField::encode(byte, frame);
+  }
+}
+
+/**
+ * Write the acknowledged pulse trace of a message
+ * @param message Message
+ * @param timestamp Start bit time in microseconds
+ * @param trace Destination, MAX_FRAME_BIT_SIZE pulses are enough for any message
+ * @return Number of written pulses
+ */
+inline auto makeTrace(Message const& message, Time const timestamp, std::span<Pulse> const trace) -> Size {
+  static Frame frame;
+  encode(message, frame);
+
+  return SimulatedBus::makeTrace(frame.getSymbols(), timestamp, true, trace);
+}
+
+/**
+ * Load the simulated bus with a single frame
+ * @param bus Simulated bus
+ * @param message Message
+ * @param trace Pulse storage, it has to outlive the bus replay
+ */
+inline auto loadFrame(SimulatedBus& bus, Message const& message, std::span<Pulse> const trace) -> void {
+  auto const size = makeTrace(message, 1000, trace);
+  bus.load(trace.first(size));
+}
+
+} // namespace iebus::test
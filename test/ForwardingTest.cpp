@@ -0,0 +1,104 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <array>
+#include <span>
+
+#include <freertos/task.h>
+
+#include <iebus/Controller.hpp>
+#include <iebus/SimulatedBus.hpp>
+
+#include "Check.hpp"
+#include "Fixture.hpp"
+
+using namespace iebus;
+
+namespace {
+
+auto constexpr SOURCE_ADDRESS = 0x456;
+auto constexpr TARGET_ADDRESS = 0x457;
+auto constexpr CAPACITY       = 4;
+
+/**
+ * Frame that is not addressed to the source, so it is forwarded
+ */
+auto loadFrame(SimulatedBus& bus, std::span<Pulse> const trace) -> void {
+  test::loadFrame(bus, test::makeMessage(BroadcastType::FOR_DEVICE, 0x123, 0x789, 2), trace);
+}
+
+auto testStoppedTarget() -> void {
+  static std::array<Pulse, MAX_FRAME_BIT_SIZE> trace = {};
+
+  static SimulatedBus sourceBus;
+  static SimulatedBus targetBus;
+  loadFrame(sourceBus, trace);
+
+  static Controller source(sourceBus, SOURCE_ADDRESS);
+  static Controller target(targetBus, TARGET_ADDRESS);
+  source.enable();
+  target.enable();
+
+  source.setForwarding(&target);
+  IEBUS_CHECK(source.attachReceiver(xTaskGetCurrentTaskHandle(), CAPACITY));
+
+  IEBUS_CHECK(source.serviceReceiver(0));
+  IEBUS_CHECK(source.getDroppedCount() == 1);
+  IEBUS_CHECK(source.getStatistics().getSnapshot().forwardDropCount == 1);
+
+  source.detachReceiver();
+  source.disable();
+  target.disable();
+}
+
+auto testRunningTarget() -> void {
+  static std::array<Pulse, MAX_FRAME_BIT_SIZE> trace = {};
+
+  static SimulatedBus sourceBus;
+  static SimulatedBus targetBus;
+  loadFrame(sourceBus, trace);
+
+  static Controller source(sourceBus, SOURCE_ADDRESS);
+  static Controller target(targetBus, TARGET_ADDRESS);
+  source.enable();
+  target.enable();
+
+  source.setForwarding(&target);
+  IEBUS_CHECK(source.attachReceiver(xTaskGetCurrentTaskHandle(), CAPACITY));
+  IEBUS_CHECK(target.attachReceiver(xTaskGetCurrentTaskHandle(), CAPACITY));
+
+  IEBUS_CHECK(source.serviceReceiver(0));
+  IEBUS_CHECK(source.getDroppedCount() == 0);
+
+  static_cast<void>(target.serviceReceiver(0));
+  IEBUS_CHECK(target.getStatistics().getSnapshot().framesSent == 1);
+
+  target.detachReceiver();
+  source.detachReceiver();
+  source.disable();
+  target.disable();
+}
+
+} // namespace
+
+auto main() -> int {
+  testStoppedTarget();
+  testRunningTarget();
+
+  return test::getResult();
+}
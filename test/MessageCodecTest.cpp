@@ -0,0 +1,148 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <algorithm>
+#include <array>
+
+#include <iebus/Message.hpp>
+#include <iebus/MessageCodec.hpp>
+
+#include "Check.hpp"
+#include "Fixture.hpp"
+
+using namespace iebus;
+
+namespace {
+
+auto makeMessage(BroadcastType const broadcast, Size const dataLength) -> Message {
+  return test::makeMessage(broadcast, 0x123, 0xFED, dataLength);
+}
+
+auto isEqual(MessageCodec::Record const& record, Message const& message) -> bool {
+  auto const data = message.getData();
+
+  return record.broadcast == message.broadcast and record.master == message.master and record.slave == message.slave and record.control == message.control and
+         std::equal(record.data.begin(), record.data.end(), data.begin(), data.end());
+}
+
+auto testRoundTrip() -> void {
+  std::array<Byte, MessageCodec::MAX_RECORD_SIZE> buffer = {};
+
+  for (Size const length : {0, 1, 17, MAX_MESSAGE_SIZE}) {
+    for (auto const broadcast : {BroadcastType::BROADCAST, BroadcastType::FOR_DEVICE}) {
+      auto const message = makeMessage(broadcast, length);
+      auto const record  = MessageCodec::makeRecord(message);
+
+      auto const size = MessageCodec::encode(record, buffer);
+      IEBUS_CHECK(size == MessageCodec::HEADER_SIZE + length);
+      IEBUS_CHECK(size == MessageCodec::getSize(record));
+
+      auto const decoded = MessageCodec::decode(std::span(buffer).first(size));
+      IEBUS_CHECK(decoded and isEqual(*decoded, message));
+      IEBUS_CHECK(decoded and not decoded->timestamp);
+
+      Message copy = {};
+      MessageCodec::toMessage(*decoded, copy);
+      IEBUS_CHECK(isEqual(record, copy));
+    }
+  }
+}
+
+auto testTimestamp() -> void {
+  std::array<Byte, MessageCodec::MAX_RECORD_SIZE> buffer = {};
+
+  auto const message = makeMessage(BroadcastType::FOR_DEVICE, 4);
+  auto const record  = MessageCodec::makeRecord(message, 0x0123456789ABLL);
+
+  auto const size = MessageCodec::encode(record, buffer);
+  IEBUS_CHECK(size == MessageCodec::HEADER_SIZE + MessageCodec::TIMESTAMP_SIZE + 4);
+
+  auto const decoded = MessageCodec::decode(std::span(buffer).first(size));
+  IEBUS_CHECK(decoded and decoded->timestamp == 0x0123456789ABLL);
+  IEBUS_CHECK(decoded and isEqual(*decoded, message));
+}
+
+auto testHeaderParts() -> void {
+  auto const message = makeMessage(BroadcastType::FOR_DEVICE, 3);
+  auto const parts   = MessageCodec::encode(MessageCodec::makeRecord(message));
+
+  IEBUS_CHECK(parts.getHeader().size() == MessageCodec::HEADER_SIZE);
+  IEBUS_CHECK(parts.data.data() == message.data.data());
+  IEBUS_CHECK(parts.data.size() == 3);
+}
+
+auto testInvalid() -> void {
+  std::array<Byte, MessageCodec::MAX_RECORD_SIZE> buffer = {};
+
+  auto const message = makeMessage(BroadcastType::FOR_DEVICE, 8);
+  auto const size    = MessageCodec::encode(MessageCodec::makeRecord(message), buffer);
+
+  IEBUS_CHECK(not MessageCodec::decode(std::span(buffer).first(MessageCodec::HEADER_SIZE - 1)));
+  IEBUS_CHECK(not MessageCodec::decode(std::span(buffer).first(size - 1)));
+
+  std::array<Byte, 4> small = {};
+  IEBUS_CHECK(MessageCodec::encode(MessageCodec::makeRecord(message), small) == 0);
+}
+
+auto testBatch() -> void {
+  std::array<Byte, 256> buffer = {};
+  MessageBatchWriter writer(buffer);
+
+  auto const first  = makeMessage(BroadcastType::FOR_DEVICE, 5);
+  auto const second = makeMessage(BroadcastType::BROADCAST, 0);
+
+  IEBUS_CHECK(writer.append(MessageCodec::makeRecord(first)));
+  IEBUS_CHECK(writer.append(MessageCodec::makeRecord(second, 42)));
+  IEBUS_CHECK(writer.getCount() == 2);
+
+  MessageBatchReader reader(writer.getData());
+  IEBUS_CHECK(reader.isValid());
+  IEBUS_CHECK(reader.getCount() == 2);
+
+  auto const firstRecord = reader.next();
+  IEBUS_CHECK(firstRecord and isEqual(*firstRecord, first));
+
+  auto const secondRecord = reader.next();
+  IEBUS_CHECK(secondRecord and isEqual(*secondRecord, second));
+  IEBUS_CHECK(secondRecord and secondRecord->timestamp == 42);
+
+  IEBUS_CHECK(not reader.next());
+
+  auto const large = makeMessage(BroadcastType::FOR_DEVICE, MAX_MESSAGE_SIZE);
+  IEBUS_CHECK(not writer.append(MessageCodec::makeRecord(large)));
+  IEBUS_CHECK(writer.getCount() == 2);
+
+  writer.reset();
+  IEBUS_CHECK(writer.getCount() == 0);
+  IEBUS_CHECK(MessageBatchReader(writer.getData()).getCount() == 0);
+
+  std::array<Byte, 4> const corrupted = {'X', 1, 0, 0};
+  IEBUS_CHECK(not MessageBatchReader(corrupted).isValid());
+}
+
+} // namespace
+
+auto main() -> int {
+  testRoundTrip();
+  testTimestamp();
+  testHeaderParts();
+  testInvalid();
+  testBatch();
+
+  return test::getResult();
+}
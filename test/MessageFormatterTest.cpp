@@ -0,0 +1,102 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+#include <iebus/Message.hpp>
+#include <iebus/MessageFormatter.hpp>
+
+#include "Check.hpp"
+#include "Fixture.hpp"
+
+using namespace iebus;
+
+namespace {
+
+auto makeMessage(BroadcastType const broadcast, Size const dataLength) -> Message {
+  return test::makeMessage(broadcast, 0x123, 0x456, dataLength);
+}
+
+auto testText() -> void {
+  auto message    = makeMessage(BroadcastType::FOR_DEVICE, 2);
+  message.data[0] = 0x0A;
+  message.data[1] = 0xFF;
+
+  IEBUS_CHECK(message.toString() == "D M0x0123 S0x0456 C0x0f L2 [0A FF]");
+  IEBUS_CHECK(makeMessage(BroadcastType::BROADCAST, 0).toString() == "B M0x0123 S0x0456 C0x0f L0 []");
+}
+
+auto testSize() -> void {
+  for (Size const length : {0, 1, 9, 10, 99, 100, MAX_MESSAGE_SIZE}) {
+    auto const text = makeMessage(BroadcastType::FOR_DEVICE, length).toString();
+
+    IEBUS_CHECK(text.size() == MessageFormatter::getSize(length));
+  }
+
+  IEBUS_CHECK(MessageFormatter::getSize(MAX_MESSAGE_SIZE) == MessageFormatter::MAX_SIZE);
+}
+
+auto testBuffer() -> void {
+  auto const message = makeMessage(BroadcastType::FOR_DEVICE, 3);
+  auto const text    = message.toString();
+
+  std::array<char, MessageFormatter::MAX_SIZE + 1> buffer = {};
+
+  auto const size = message.format(buffer);
+  IEBUS_CHECK(size == text.size());
+  IEBUS_CHECK(std::strcmp(buffer.data(), text.c_str()) == 0);
+}
+
+auto testTruncation() -> void {
+  auto const message = makeMessage(BroadcastType::FOR_DEVICE, 3);
+  auto const text    = message.toString();
+
+  std::array<char, 8> buffer = {};
+  buffer.fill('#');
+
+  auto const size = message.format(buffer);
+  IEBUS_CHECK(size == buffer.size() - 1);
+  IEBUS_CHECK(buffer.back() == '\0');
+  IEBUS_CHECK(text.compare(0, size, buffer.data()) == 0);
+
+  IEBUS_CHECK(message.format(std::span<char>()) == 0);
+}
+
+auto testOutputIterator() -> void {
+  auto const message = makeMessage(BroadcastType::FOR_DEVICE, 1);
+
+  std::string text;
+  MessageFormatter::format(std::back_inserter(text), message.broadcast, message.master, message.slave, message.control, message.getData());
+
+  IEBUS_CHECK(text == message.toString());
+}
+
+} // namespace
+
+auto main() -> int {
+  testText();
+  testSize();
+  testBuffer();
+  testTruncation();
+  testOutputIterator();
+
+  return test::getResult();
+}
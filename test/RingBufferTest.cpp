@@ -0,0 +1,102 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <array>
+
+#include <iebus/RingBuffer.hpp>
+
+#include "Check.hpp"
+
+using namespace iebus;
+
+namespace {
+
+auto testOrder() -> void {
+  RingBuffer<int, 4> buffer;
+
+  IEBUS_CHECK(buffer.isEmpty());
+  IEBUS_CHECK(not buffer.pop().has_value());
+
+  IEBUS_CHECK(buffer.push(1));
+  IEBUS_CHECK(buffer.push(2));
+  IEBUS_CHECK(buffer.getSize() == 2);
+
+  IEBUS_CHECK(buffer.pop() == 1);
+  IEBUS_CHECK(buffer.pop() == 2);
+  IEBUS_CHECK(buffer.isEmpty());
+}
+
+auto testFull() -> void {
+  RingBuffer<int, 4> buffer;
+
+  for (int i = 0; i < 4; ++i) {
+    IEBUS_CHECK(buffer.push(i));
+  }
+
+  IEBUS_CHECK(not buffer.push(4));
+  IEBUS_CHECK(buffer.getSize() == 4);
+
+  IEBUS_CHECK(buffer.pop() == 0);
+  IEBUS_CHECK(buffer.push(4));
+  IEBUS_CHECK(buffer.pop() == 1);
+}
+
+auto testWrapAround() -> void {
+  RingBuffer<int, 4> buffer;
+
+  for (int i = 0; i < 100; ++i) {
+    IEBUS_CHECK(buffer.push(i));
+    IEBUS_CHECK(buffer.push(i + 1000));
+    IEBUS_CHECK(buffer.pop() == i);
+    IEBUS_CHECK(buffer.pop() == i + 1000);
+  }
+
+  IEBUS_CHECK(buffer.isEmpty());
+}
+
+auto testBatch() -> void {
+  RingBuffer<int, 8> buffer;
+
+  std::array<int, 5> const items = {1, 2, 3, 4, 5};
+  IEBUS_CHECK(buffer.push(std::span<int const>(items)));
+  IEBUS_CHECK(not buffer.push(std::span<int const>(items)));
+  IEBUS_CHECK(buffer.getSize() == items.size());
+
+  std::array<int, 3> taken = {};
+  IEBUS_CHECK(buffer.pop(taken) == 3);
+  IEBUS_CHECK(taken[0] == 1 and taken[2] == 3);
+
+  IEBUS_CHECK(buffer.push(std::span<int const>(items)));
+  IEBUS_CHECK(buffer.getSize() == 7);
+
+  std::array<int, 8> rest = {};
+  IEBUS_CHECK(buffer.pop(rest) == 7);
+  IEBUS_CHECK(rest[0] == 4 and rest[1] == 5 and rest[2] == 1 and rest[6] == 5);
+  IEBUS_CHECK(buffer.pop(rest) == 0);
+}
+
+} // namespace
+
+auto main() -> int {
+  testOrder();
+  testFull();
+  testWrapAround();
+  testBatch();
+
+  return test::getResult();
+}
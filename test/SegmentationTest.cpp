@@ -0,0 +1,189 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+#include <iebus/Controller.hpp>
+#include <iebus/Segmentation.hpp>
+#include <iebus/SimulatedBus.hpp>
+
+#include "Check.hpp"
+#include "Fixture.hpp"
+
+using namespace iebus;
+
+namespace {
+
+auto constexpr OWN_ADDRESS   = 0x456;
+auto constexpr OTHER_ADDRESS = 0x123;
+auto constexpr FRAME_GAP_US  = 20000;
+auto constexpr PAYLOAD_SIZE  = SEGMENT_PAYLOAD_SIZE * 2 + 10;
+auto constexpr SEGMENT_COUNT = getSegmentCount(PAYLOAD_SIZE);
+
+auto makePayload() -> std::array<Byte, PAYLOAD_SIZE> {
+  std::array<Byte, PAYLOAD_SIZE> payload = {};
+  for (Size i = 0; i < payload.size(); ++i) {
+    payload[i] = static_cast<Byte>(i * 13 + 1);
+  }
+
+  return payload;
+}
+
+auto makeSegment(Address const master, std::span<Byte const> const payload, Size const index) -> Message {
+  auto const offset = index * SEGMENT_PAYLOAD_SIZE;
+  auto const size   = std::min<Size>(payload.size() - offset, SEGMENT_PAYLOAD_SIZE);
+
+  Message message = {
+      .broadcast  = BroadcastType::FOR_DEVICE,
+      .master     = master,
+      .slave      = OWN_ADDRESS,
+      .control    = 0xF,
+      .dataLength = SEGMENT_HEADER_SIZE + size,
+      .data       = {},
+  };
+
+  message.data[0] = static_cast<Byte>(index);
+  message.data[1] = static_cast<Byte>(getSegmentCount(payload.size()) - 1);
+  std::copy_n(payload.begin() + static_cast<std::ptrdiff_t>(offset), size, message.data.begin() + SEGMENT_HEADER_SIZE);
+
+  return message;
+}
+
+auto testSegmentCount() -> void {
+  IEBUS_CHECK(getSegmentCount(0) == 1);
+  IEBUS_CHECK(getSegmentCount(1) == 1);
+  IEBUS_CHECK(getSegmentCount(SEGMENT_PAYLOAD_SIZE) == 1);
+  IEBUS_CHECK(getSegmentCount(SEGMENT_PAYLOAD_SIZE + 1) == 2);
+  IEBUS_CHECK(getSegmentCount(MAX_SEGMENTED_SIZE) == MAX_SEGMENT_COUNT);
+}
+
+auto testReassembleOutOfOrder() -> void {
+  auto const payload = makePayload();
+
+  std::array<Byte, PAYLOAD_SIZE> buffer = {};
+  Reassembler reassembler(buffer);
+
+  IEBUS_CHECK(reassembler.accept(makeSegment(OTHER_ADDRESS, payload, 2)) == Reassembler::Status::IN_PROGRESS);
+  IEBUS_CHECK(reassembler.accept(makeSegment(OTHER_ADDRESS, payload, 0)) == Reassembler::Status::IN_PROGRESS);
+  IEBUS_CHECK(reassembler.accept(makeSegment(OTHER_ADDRESS, payload, 0)) == Reassembler::Status::IN_PROGRESS);
+  IEBUS_CHECK(not reassembler.isComplete());
+  IEBUS_CHECK(reassembler.getData().empty());
+
+  IEBUS_CHECK(reassembler.accept(makeSegment(OTHER_ADDRESS, payload, 1)) == Reassembler::Status::COMPLETE);
+
+  auto const data = reassembler.getData();
+  IEBUS_CHECK(std::equal(data.begin(), data.end(), payload.begin(), payload.end()));
+}
+
+auto testReassembleInvalid() -> void {
+  auto const payload = makePayload();
+
+  std::array<Byte, SEGMENT_PAYLOAD_SIZE> buffer = {};
+  Reassembler reassembler(buffer);
+
+  auto shortSegment       = makeSegment(OTHER_ADDRESS, payload, 0);
+  shortSegment.dataLength = 1;
+  IEBUS_CHECK(reassembler.accept(shortSegment) == Reassembler::Status::INVALID);
+
+  auto truncatedSegment       = makeSegment(OTHER_ADDRESS, payload, 0);
+  truncatedSegment.dataLength = SEGMENT_HEADER_SIZE + 10;
+  IEBUS_CHECK(reassembler.accept(truncatedSegment) == Reassembler::Status::INVALID);
+
+  auto badIndex    = makeSegment(OTHER_ADDRESS, payload, 0);
+  badIndex.data[0] = static_cast<Byte>(SEGMENT_COUNT);
+  IEBUS_CHECK(reassembler.accept(badIndex) == Reassembler::Status::INVALID);
+
+  IEBUS_CHECK(reassembler.accept(makeSegment(OTHER_ADDRESS, payload, 1)) == Reassembler::Status::BUFFER_OVERFLOW);
+  IEBUS_CHECK(reassembler.commit() == Reassembler::Status::INVALID);
+}
+
+auto testReassembleNewTransfer() -> void {
+  auto const payload = makePayload();
+
+  std::array<Byte, PAYLOAD_SIZE> buffer = {};
+  Reassembler reassembler(buffer);
+
+  IEBUS_CHECK(reassembler.accept(makeSegment(OTHER_ADDRESS, payload, 0)) == Reassembler::Status::IN_PROGRESS);
+  IEBUS_CHECK(reassembler.accept(makeSegment(OTHER_ADDRESS, payload, 1)) == Reassembler::Status::IN_PROGRESS);
+
+  IEBUS_CHECK(reassembler.accept(makeSegment(0x321, payload, 2)) == Reassembler::Status::IN_PROGRESS);
+  IEBUS_CHECK(reassembler.accept(makeSegment(0x321, payload, 0)) == Reassembler::Status::IN_PROGRESS);
+  IEBUS_CHECK(not reassembler.isComplete());
+}
+
+auto testReadSegment() -> void {
+  auto const payload = makePayload();
+
+  static std::array<Pulse, MAX_FRAME_BIT_SIZE * SEGMENT_COUNT> trace = {};
+
+  Size size = 0;
+  for (Size i = 0; i < SEGMENT_COUNT; ++i) {
+    size += test::makeTrace(makeSegment(OTHER_ADDRESS, payload, SEGMENT_COUNT - 1 - i), 1000 + i * FRAME_GAP_US, std::span(trace).subspan(size));
+  }
+
+  static SimulatedBus bus;
+  bus.load(std::span(trace).first(size));
+
+  static Controller controller(bus, OWN_ADDRESS);
+  controller.enable();
+
+  std::array<Byte, PAYLOAD_SIZE> buffer = {};
+  Reassembler reassembler(buffer);
+
+  IEBUS_CHECK(controller.readSegment(reassembler, 0) == Reassembler::Status::IN_PROGRESS);
+  IEBUS_CHECK(controller.readSegment(reassembler, 0) == Reassembler::Status::IN_PROGRESS);
+  IEBUS_CHECK(controller.readSegment(reassembler, 0) == Reassembler::Status::COMPLETE);
+  IEBUS_CHECK(controller.readSegment(reassembler, 0) == Reassembler::Status::INVALID);
+
+  auto const data = reassembler.getData();
+  IEBUS_CHECK(std::equal(data.begin(), data.end(), payload.begin(), payload.end()));
+
+  controller.disable();
+}
+
+auto testWriteSegmented() -> void {
+  auto const payload = makePayload();
+
+  static SimulatedBus bus;
+  static Controller controller(bus, OWN_ADDRESS);
+  controller.enable();
+
+  IEBUS_CHECK(controller.writeSegmented(BroadcastType::FOR_DEVICE, OWN_ADDRESS, OTHER_ADDRESS, 0xF, payload, 2));
+  IEBUS_CHECK(controller.getStatistics().getSnapshot().framesSent == SEGMENT_COUNT);
+
+  bus.setAcknowledgment(false);
+  IEBUS_CHECK(not controller.writeSegmented(BroadcastType::FOR_DEVICE, OWN_ADDRESS, OTHER_ADDRESS, 0xF, payload, 2));
+  IEBUS_CHECK(controller.getStatistics().getSnapshot().framesSent == SEGMENT_COUNT);
+
+  controller.disable();
+}
+
+} // namespace
+
+auto main() -> int {
+  testSegmentCount();
+  testReassembleOutOfOrder();
+  testReassembleInvalid();
+  testReassembleNewTransfer();
+  testReadSegment();
+  testWriteSegmented();
+
+  return test::getResult();
+}
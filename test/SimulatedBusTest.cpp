@@ -0,0 +1,156 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <array>
+#include <span>
+
+#include <iebus/Controller.hpp>
+#include <iebus/SimulatedBus.hpp>
+
+#include "Check.hpp"
+#include "Fixture.hpp"
+
+using namespace iebus;
+
+namespace {
+
+auto constexpr OWN_ADDRESS   = 0x456;
+auto constexpr OTHER_ADDRESS = 0x123;
+auto constexpr FRAME_GAP_US  = 20000;
+
+auto makeMessage(Address const master, Address const slave, std::span<Byte const> const data) -> Message {
+  return test::makeMessage(BroadcastType::FOR_DEVICE, master, slave, data);
+}
+
+auto isEqual(Message const& left, Message const& right) -> bool {
+  auto const leftData  = left.getData();
+  auto const rightData = right.getData();
+
+  return left.broadcast == right.broadcast and left.master == right.master and left.slave == right.slave and left.control == right.control and
+         std::equal(leftData.begin(), leftData.end(), rightData.begin(), rightData.end());
+}
+
+auto testReceive() -> void {
+  std::array<Byte, 3> const data = {0xAA, 0x55, 0x01};
+  auto const expected            = makeMessage(OTHER_ADDRESS, OWN_ADDRESS, data);
+
+  static std::array<Pulse, MAX_FRAME_BIT_SIZE * 2> trace = {};
+  auto size = test::makeTrace(expected, 1000, trace);
+  size += test::makeTrace(expected, 1000 + FRAME_GAP_US, std::span(trace).subspan(size));
+
+  static SimulatedBus bus;
+  bus.load(std::span(trace).first(size));
+
+  static Controller controller(bus, OWN_ADDRESS);
+  controller.enable();
+
+  auto const first = controller.readMessage(0);
+  IEBUS_CHECK(first.has_value());
+  IEBUS_CHECK(first and isEqual(*first, expected));
+
+  auto const second = controller.readMessage(0);
+  IEBUS_CHECK(second and isEqual(*second, expected));
+
+  IEBUS_CHECK(not controller.readMessage(0));
+  IEBUS_CHECK(bus.isFinished());
+
+  auto const statistics = controller.getStatistics().getSnapshot();
+  IEBUS_CHECK(statistics.framesReceived == 2);
+
+  controller.disable();
+}
+
+auto testTransmit() -> void {
+  std::array<Byte, 2> const data = {0x01, 0x02};
+  auto const message             = makeMessage(OWN_ADDRESS, 0x789, data);
+
+  static SimulatedBus bus;
+  static Controller controller(bus, OWN_ADDRESS);
+  controller.enable();
+
+  IEBUS_CHECK(controller.writeMessage(message));
+
+  bus.setAcknowledgment(false);
+  IEBUS_CHECK(not controller.writeMessage(message));
+
+  auto const statistics = controller.getStatistics().getSnapshot();
+  IEBUS_CHECK(statistics.framesSent == 1);
+  IEBUS_CHECK(statistics.nakCount == 1);
+
+  controller.disable();
+}
+
+auto testBatch() -> void {
+  std::array<Byte, 2> const data        = {0x01, 0x02};
+  std::array<Message, 3> const messages = {
+      makeMessage(OWN_ADDRESS, 0x789, data),
+      makeMessage(OWN_ADDRESS, 0x78A, data),
+      makeMessage(OWN_ADDRESS, 0x78B, data),
+  };
+
+  static SimulatedBus bus;
+  static Controller controller(bus, OWN_ADDRESS);
+  controller.enable();
+
+  IEBUS_CHECK(controller.writeMessages(messages) == 0b111);
+
+  bus.failTransmission(1);
+  IEBUS_CHECK(controller.writeMessages(messages) == 0b101);
+
+  auto const statistics = controller.getStatistics().getSnapshot();
+  IEBUS_CHECK(statistics.framesSent == 5);
+  IEBUS_CHECK(statistics.nakCount == 1);
+
+  std::array<Message, Controller::MAX_BATCH_SIZE + 1> const tooLong = {};
+  IEBUS_CHECK(controller.writeMessages(tooLong) == 0);
+
+  controller.disable();
+}
+
+auto testLargeFrame() -> void {
+  std::array<Byte, MAX_MESSAGE_SIZE - 1> data = {};
+  for (Size i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<Byte>(i * 7);
+  }
+
+  auto const expected = makeMessage(OTHER_ADDRESS, OWN_ADDRESS, data);
+
+  static std::array<Pulse, MAX_FRAME_BIT_SIZE> trace = {};
+
+  static SimulatedBus bus;
+  test::loadFrame(bus, expected, trace);
+
+  static Controller controller(bus, OWN_ADDRESS);
+  controller.enable();
+
+  auto const received = controller.readMessage(0);
+  IEBUS_CHECK(received and isEqual(*received, expected));
+
+  controller.disable();
+}
+
+} // namespace
+
+auto main() -> int {
+  testReceive();
+  testTransmit();
+  testBatch();
+  testLargeFrame();
+
+  return test::getResult();
+}
@@ -0,0 +1,180 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <array>
+#include <utility>
+
+#include <freertos/task.h>
+
+#include <iebus/MessagePool.hpp>
+#include <iebus/TransmitScheduler.hpp>
+
+#include "Check.hpp"
+
+using namespace iebus;
+
+namespace {
+
+struct Completion {
+  std::array<TransmitStatus, TransmitScheduler::CAPACITY * 2> statuses;
+  Size count;
+};
+
+auto onComplete(TransmitStatus const status, void* const context) -> void {
+  auto& completion = *static_cast<Completion*>(context);
+
+  completion.statuses[completion.count++] = status;
+}
+
+auto push(MessagePool& pool, TransmitScheduler& scheduler, Byte const control, TransmitScheduler::Options const& options) -> bool {
+  auto message = pool.acquire();
+  if (not message) {
+    return false;
+  }
+
+  message->control = control;
+  return scheduler.push(std::move(message), options);
+}
+
+auto takeNext(TransmitScheduler& scheduler, TickType_t const now) -> std::optional<Byte> {
+  auto const index = scheduler.next(now);
+  if (not index) {
+    return std::nullopt;
+  }
+
+  auto const control = scheduler.getMessage(*index).control;
+  scheduler.complete(*index, true, now);
+
+  return control;
+}
+
+auto testPriorityOrder() -> void {
+  MessagePool pool;
+  IEBUS_CHECK(pool.create(TransmitScheduler::CAPACITY));
+
+  TransmitScheduler scheduler;
+
+  IEBUS_CHECK(push(pool, scheduler, 1, {.priority = TransmitPriority::LOW}));
+  IEBUS_CHECK(push(pool, scheduler, 2, {.priority = TransmitPriority::NORMAL}));
+  IEBUS_CHECK(push(pool, scheduler, 3, {.priority = TransmitPriority::URGENT}));
+  IEBUS_CHECK(push(pool, scheduler, 4, {.priority = TransmitPriority::NORMAL}));
+  IEBUS_CHECK(push(pool, scheduler, 5, {.priority = TransmitPriority::HIGH}));
+
+  auto const now = xTaskGetTickCount();
+
+  IEBUS_CHECK(takeNext(scheduler, now) == 3);
+  IEBUS_CHECK(takeNext(scheduler, now) == 5);
+  IEBUS_CHECK(takeNext(scheduler, now) == 2);
+  IEBUS_CHECK(takeNext(scheduler, now) == 4);
+  IEBUS_CHECK(takeNext(scheduler, now) == 1);
+  IEBUS_CHECK(not scheduler.next(now));
+
+  IEBUS_CHECK(pool.getAvailable() == TransmitScheduler::CAPACITY);
+}
+
+auto testBackoff() -> void {
+  MessagePool pool;
+  IEBUS_CHECK(pool.create(1));
+
+  TransmitScheduler scheduler;
+  Completion completion = {};
+
+  TransmitScheduler::Options const options = {
+      .priority   = TransmitPriority::NORMAL,
+      .retryCount = 3,
+      .backoff    = 10,
+      .timeout    = portMAX_DELAY,
+      .callback   = onComplete,
+      .context    = &completion,
+  };
+
+  IEBUS_CHECK(push(pool, scheduler, 1, options));
+
+  auto now   = xTaskGetTickCount();
+  auto index = scheduler.next(now);
+  IEBUS_CHECK(index.has_value());
+
+  for (TickType_t const backoff : {10, 20, 40}) {
+    scheduler.complete(*index, false, now);
+
+    IEBUS_CHECK(scheduler.getWaitTime(now) == backoff);
+    IEBUS_CHECK(not scheduler.next(now + backoff - 1));
+
+    now += backoff;
+
+    index = scheduler.next(now);
+    IEBUS_CHECK(index.has_value());
+    IEBUS_CHECK(completion.count == 0);
+  }
+
+  scheduler.complete(*index, false, now);
+
+  IEBUS_CHECK(completion.count == 1);
+  IEBUS_CHECK(completion.statuses[0] == TransmitStatus::FAILED);
+  IEBUS_CHECK(scheduler.getWaitTime(now) == portMAX_DELAY);
+  IEBUS_CHECK(pool.getAvailable() == 1);
+}
+
+auto testExpireAndCancel() -> void {
+  MessagePool pool;
+  IEBUS_CHECK(pool.create(2));
+
+  TransmitScheduler scheduler;
+  Completion completion = {};
+
+  IEBUS_CHECK(push(pool, scheduler, 1, {.timeout = 5, .callback = onComplete, .context = &completion}));
+  IEBUS_CHECK(push(pool, scheduler, 2, {.callback = onComplete, .context = &completion}));
+
+  auto const now = xTaskGetTickCount();
+
+  scheduler.expire(now + 1000);
+  IEBUS_CHECK(completion.count == 1);
+  IEBUS_CHECK(completion.statuses[0] == TransmitStatus::EXPIRED);
+
+  scheduler.cancel();
+  IEBUS_CHECK(completion.count == 2);
+  IEBUS_CHECK(completion.statuses[1] == TransmitStatus::CANCELLED);
+  IEBUS_CHECK(pool.getAvailable() == 2);
+}
+
+auto testCapacity() -> void {
+  MessagePool pool;
+  IEBUS_CHECK(pool.create(TransmitScheduler::CAPACITY + 1));
+
+  TransmitScheduler scheduler;
+
+  for (Size i = 0; i < TransmitScheduler::CAPACITY; ++i) {
+    IEBUS_CHECK(push(pool, scheduler, static_cast<Byte>(i), {}));
+  }
+
+  IEBUS_CHECK(not push(pool, scheduler, 0xF, {}));
+  IEBUS_CHECK(pool.getAvailable() == 1);
+
+  scheduler.cancel();
+}
+
+} // namespace
+
+auto main() -> int {
+  testPriorityOrder();
+  testBackoff();
+  testExpireAndCancel();
+  testCapacity();
+
+  return test::getResult();
+}
@@ -0,0 +1,246 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include <esp_timer.h>
+
+#include <iebus/Controller.hpp>
+#include <iebus/Frame.hpp>
+#include <iebus/MessageCodec.hpp>
+#include <iebus/SimulatedBus.hpp>
+
+#include "../Fixture.hpp"
+
+using namespace iebus;
+
+namespace {
+
+auto constexpr OWN_ADDRESS    = 0x456;
+auto constexpr MASTER_ADDRESS = 0x123;
+auto constexpr DATA_SIZE      = 32;
+auto constexpr FRAME_GAP_US   = 1000;
+
+auto constexpr DEFAULT_FRAME_COUNT = 2000;
+
+/**
+ * The pulse trace of a frame takes about 6 KiB, the target runs fewer frames to fit into the heap
+ */
+auto constexpr TARGET_FRAME_COUNT = 20;
+
+/**
+ * Keep the result of a measured loop alive
+ */
+volatile std::uint32_t sink = 0;
+
+struct Result {
+  char const* name;
+  Size frameCount;
+  /**
+   * Duration in microseconds from esp_timer_get_time()
+   */
+  Time duration;
+};
+
+auto makeMessage(Size const index) -> Message {
+  auto message = test::makeMessage(BroadcastType::FOR_DEVICE, MASTER_ADDRESS, OWN_ADDRESS, DATA_SIZE);
+
+  for (Size i = 0; i < DATA_SIZE; ++i) {
+    message.data[i] = static_cast<Byte>(index + i * 31);
+  }
+
+  return message;
+}
+
+auto report(Result const& result) -> void {
+  auto const seconds         = static_cast<double>(result.duration) / 1000000;
+  auto const framesPerSecond = seconds > 0 ? static_cast<double>(result.frameCount) / seconds : 0.0;
+
+  std::printf("%-10s %8zu frames %10.3f ms %12.0f frames/s\n", result.name, result.frameCount, seconds * 1000, framesPerSecond);
+}
+
+/**
+ * Parity of every field of a frame
+ */
+auto measureParity(Size const frameCount) -> Result {
+  auto const start = esp_timer_get_time();
+
+  std::uint32_t parity = 0;
+  for (Size i = 0; i < frameCount; ++i) {
+    parity ^= MasterAddressField::calculateParity(static_cast<Data>(i));
+    parity ^= SlaveAddressField::calculateParity(static_cast<Data>(i >> 1));
+    parity ^= ControlField::calculateParity(static_cast<Data>(i));
+    parity ^= DataLengthField::calculateParity(DATA_SIZE);
+
+    for (Size j = 0; j < DATA_SIZE; ++j) {
+      parity ^= DataField::calculateParity(static_cast<Data>(i + j));
+    }
+  }
+
+  sink = parity;
+  return {.name = "parity", .frameCount = frameCount, .duration = esp_timer_get_time() - start};
+}
+
+auto measureEncode(Size const frameCount) -> Result {
+  static Frame frame;
+
+  auto const message = makeMessage(0);
+  auto const start   = esp_timer_get_time();
+
+  for (Size i = 0; i < frameCount; ++i) {
+    test::encode(message, frame);
+    sink = static_cast<std::uint32_t>(frame.getSymbols().size());
+  }
+
+  return {.name = "encode", .frameCount = frameCount, .duration = esp_timer_get_time() - start};
+}
+
+auto makeTrace(Size const frameCount) -> std::vector<Pulse> {
+  std::vector<Pulse> trace(frameCount * MAX_FRAME_BIT_SIZE);
+
+  Size size      = 0;
+  Time timestamp = 1000;
+  for (Size i = 0; i < frameCount; ++i) {
+    auto const count = test::makeTrace(makeMessage(i), timestamp, std::span(trace).subspan(size));
+    auto const& last = trace[size + count - 1];
+
+    size += count;
+    timestamp = last.timestamp + last.highTime + FRAME_GAP_US;
+  }
+
+  trace.resize(size);
+  return trace;
+}
+
+/**
+ * Field decode of the Controller from the simulated pulse trace
+ */
+auto measureDecode(Size const frameCount, bool& isValid) -> Result {
+  auto const trace = makeTrace(frameCount);
+
+  static SimulatedBus bus;
+  bus.load(trace);
+
+  static Controller controller(bus, OWN_ADDRESS);
+  controller.enable();
+
+  Size received    = 0;
+  auto const start = esp_timer_get_time();
+
+  while (auto const message = controller.readMessage(0)) {
+    sink = message->data[0];
+    received += 1;
+  }
+
+  auto const duration = esp_timer_get_time() - start;
+
+  controller.disable();
+
+  isValid = received == frameCount;
+  return {.name = "decode", .frameCount = received, .duration = duration};
+}
+
+auto measureToString(Size const frameCount) -> Result {
+  auto const message = makeMessage(0);
+  auto const start   = esp_timer_get_time();
+
+  for (Size i = 0; i < frameCount; ++i) {
+    auto const text = message.toString();
+    sink            = static_cast<std::uint32_t>(text.size());
+  }
+
+  return {.name = "toString", .frameCount = frameCount, .duration = esp_timer_get_time() - start};
+}
+
+/**
+ * Decode from the bus and encode into the binary record format
+ */
+auto measurePipeline(Size const frameCount, bool& isValid) -> Result {
+  auto const trace = makeTrace(frameCount);
+
+  static SimulatedBus bus;
+  bus.load(trace);
+
+  static Controller controller(bus, OWN_ADDRESS);
+  controller.enable();
+
+  std::array<Byte, MessageCodec::MAX_RECORD_SIZE> buffer = {};
+
+  Size processed   = 0;
+  auto const start = esp_timer_get_time();
+
+  while (auto const message = controller.readMessage(0)) {
+    auto const record = MessageCodec::makeRecord(*message);
+    sink              = static_cast<std::uint32_t>(MessageCodec::encode(record, buffer));
+    processed += 1;
+  }
+
+  auto const duration = esp_timer_get_time() - start;
+
+  controller.disable();
+
+  isValid = processed == frameCount;
+  return {.name = "pipeline", .frameCount = processed, .duration = duration};
+}
+
+auto run(Size const frameCount) -> bool {
+  auto isDecodeValid   = false;
+  auto isPipelineValid = false;
+
+  report(measureParity(frameCount));
+  report(measureEncode(frameCount));
+  report(measureDecode(frameCount, isDecodeValid));
+  report(measureToString(frameCount));
+  report(measurePipeline(frameCount, isPipelineValid));
+
+  if (not isDecodeValid or not isPipelineValid) {
+    std::fprintf(stderr, "Not all frames were decoded\n");
+    return false;
+  }
+
+  return true;
+}
+
+#ifndef ESP_PLATFORM
+auto getFrameCount(int const argc, char** const argv) -> Size {
+  for (int i = 1; i + 1 < argc; ++i) {
+    if (std::strcmp(argv[i], "--frames") == 0) {
+      return std::strtoul(argv[i + 1], nullptr, 10);
+    }
+  }
+
+  return DEFAULT_FRAME_COUNT;
+}
+#endif
+
+} // namespace
+
+#ifdef ESP_PLATFORM
+extern "C" auto app_main() -> void {
+  static_cast<void>(run(TARGET_FRAME_COUNT));
+}
+#else
+auto main(int const argc, char** const argv) -> int {
+  return run(getFrameCount(argc, argv)) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+#endif
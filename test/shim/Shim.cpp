@@ -0,0 +1,437 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include <driver/gpio.h>
+#include <driver/rmt_rx.h>
+#include <driver/rmt_tx.h>
+#include <esp_cpu.h>
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_pm.h>
+#include <esp_rom_sys.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <sdkconfig.h>
+#include <soc/gpio_struct.h>
+
+struct QueueDefinition {
+  std::size_t length;
+  std::size_t itemSize;
+  std::deque<std::vector<unsigned char>> items;
+  UBaseType_t count;
+};
+
+struct esp_timer {
+  esp_timer_create_args_t args;
+};
+
+namespace {
+
+auto constexpr CPU_TICKS_PER_US = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+auto constexpr LOG_LEVEL_ENV    = "IEBUS_SHIM_LOG_LEVEL";
+
+auto const startTime = std::chrono::steady_clock::now();
+
+/**
+ * The only task, notified by itself only
+ */
+tskTaskControlBlock* const currentTask = reinterpret_cast<tskTaskControlBlock*>(1);
+std::uint32_t notificationValue        = 0;
+bool isNotificationPending             = false;
+
+auto getElapsed() -> std::chrono::steady_clock::duration {
+  return std::chrono::steady_clock::now() - startTime;
+}
+
+auto getLogLevel() -> int {
+  static auto const level = [] {
+    auto const* const value = std::getenv(LOG_LEVEL_ENV);
+    return value != nullptr ? std::atoi(value) : 1;
+  }();
+
+  return level;
+}
+
+auto createSemaphore(UBaseType_t const count) -> SemaphoreHandle_t {
+  return new QueueDefinition{.length = 1, .itemSize = 0, .items = {}, .count = count};
+}
+
+} // namespace
+
+auto xTaskCreate(TaskFunction_t, char const*, std::uint32_t, void*, UBaseType_t, TaskHandle_t*) -> BaseType_t {
+  return pdFAIL;
+}
+
+auto xTaskCreatePinnedToCore(TaskFunction_t, char const*, std::uint32_t, void*, UBaseType_t, TaskHandle_t*, BaseType_t) -> BaseType_t {
+  return pdFAIL;
+}
+
+auto vTaskDelete(TaskHandle_t) -> void {
+}
+
+auto vTaskDelay(TickType_t const ticks) -> void {
+  std::this_thread::sleep_for(std::chrono::milliseconds(pdTICKS_TO_MS(ticks)));
+}
+
+auto xTaskGetCurrentTaskHandle() -> TaskHandle_t {
+  return currentTask;
+}
+
+auto xTaskGetTickCount() -> TickType_t {
+  return pdMS_TO_TICKS(std::chrono::duration_cast<std::chrono::milliseconds>(getElapsed()).count());
+}
+
+auto ulTaskNotifyTake(BaseType_t const isClearOnExit, TickType_t) -> std::uint32_t {
+  auto const value = notificationValue;
+
+  if (value > 0) {
+    notificationValue = isClearOnExit == pdTRUE ? 0 : value - 1;
+  }
+
+  isNotificationPending = false;
+  return value;
+}
+
+auto xTaskNotifyGive(TaskHandle_t) -> BaseType_t {
+  notificationValue += 1;
+  isNotificationPending = true;
+  return pdPASS;
+}
+
+auto xTaskNotify(TaskHandle_t, std::uint32_t const value, eNotifyAction const action) -> BaseType_t {
+  switch (action) {
+  case eNoAction:
+    break;
+  case eSetBits:
+    notificationValue |= value;
+    break;
+  case eIncrement:
+    notificationValue += 1;
+    break;
+  case eSetValueWithOverwrite:
+    notificationValue = value;
+    break;
+  case eSetValueWithoutOverwrite:
+    if (isNotificationPending) {
+      return pdFAIL;
+    }
+    notificationValue = value;
+    break;
+  }
+
+  isNotificationPending = true;
+  return pdPASS;
+}
+
+auto xTaskNotifyWait(std::uint32_t const clearOnEntry, std::uint32_t const clearOnExit, std::uint32_t* const value, TickType_t) -> BaseType_t {
+  if (not isNotificationPending) {
+    notificationValue &= ~clearOnEntry;
+    return pdFALSE;
+  }
+
+  if (value != nullptr) {
+    *value = notificationValue;
+  }
+
+  notificationValue &= ~clearOnExit;
+  isNotificationPending = false;
+  return pdTRUE;
+}
+
+auto vTaskNotifyGiveFromISR(TaskHandle_t const task, BaseType_t*) -> void {
+  xTaskNotifyGive(task);
+}
+
+auto xQueueCreate(UBaseType_t const length, UBaseType_t const itemSize) -> QueueHandle_t {
+  return new QueueDefinition{.length = length, .itemSize = itemSize, .items = {}, .count = 0};
+}
+
+auto vQueueDelete(QueueHandle_t const queue) -> void {
+  delete queue;
+}
+
+auto xQueueSend(QueueHandle_t const queue, void const* const item, TickType_t) -> BaseType_t {
+  if (queue->items.size() >= queue->length) {
+    return errQUEUE_FULL;
+  }
+
+  auto const* const bytes = static_cast<unsigned char const*>(item);
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  return pdPASS;
+}
+
+auto xQueueSendFromISR(QueueHandle_t const queue, void const* const item, BaseType_t*) -> BaseType_t {
+  return xQueueSend(queue, item, 0);
+}
+
+auto xQueueReceive(QueueHandle_t const queue, void* const item, TickType_t) -> BaseType_t {
+  if (queue->items.empty()) {
+    return pdFALSE;
+  }
+
+  std::memcpy(item, queue->items.front().data(), queue->itemSize);
+  queue->items.pop_front();
+  return pdTRUE;
+}
+
+auto uxQueueMessagesWaiting(QueueHandle_t const queue) -> UBaseType_t {
+  return queue->items.size();
+}
+
+auto xSemaphoreCreateBinary() -> SemaphoreHandle_t {
+  return createSemaphore(0);
+}
+
+auto xSemaphoreCreateBinaryStatic(StaticSemaphore_t*) -> SemaphoreHandle_t {
+  return createSemaphore(0);
+}
+
+auto xSemaphoreCreateMutexStatic(StaticSemaphore_t*) -> SemaphoreHandle_t {
+  return createSemaphore(1);
+}
+
+auto xSemaphoreTake(SemaphoreHandle_t const semaphore, TickType_t) -> BaseType_t {
+  if (semaphore->count == 0) {
+    return pdFALSE;
+  }
+
+  semaphore->count -= 1;
+  return pdTRUE;
+}
+
+auto xSemaphoreGive(SemaphoreHandle_t const semaphore) -> BaseType_t {
+  if (semaphore->count >= semaphore->length) {
+    return pdFALSE;
+  }
+
+  semaphore->count += 1;
+  return pdTRUE;
+}
+
+auto xSemaphoreGiveFromISR(SemaphoreHandle_t const semaphore, BaseType_t*) -> BaseType_t {
+  return xSemaphoreGive(semaphore);
+}
+
+auto vSemaphoreDelete(SemaphoreHandle_t const semaphore) -> void {
+  delete semaphore;
+}
+
+auto esp_err_to_name(esp_err_t const error) -> char const* {
+  switch (error) {
+  case ESP_OK:
+    return "ESP_OK";
+  case ESP_ERR_NO_MEM:
+    return "ESP_ERR_NO_MEM";
+  case ESP_ERR_INVALID_ARG:
+    return "ESP_ERR_INVALID_ARG";
+  case ESP_ERR_INVALID_STATE:
+    return "ESP_ERR_INVALID_STATE";
+  case ESP_ERR_NOT_SUPPORTED:
+    return "ESP_ERR_NOT_SUPPORTED";
+  default:
+    return "ESP_FAIL";
+  }
+}
+
+auto esp_log_write(int const level, char const* const tag, char const* const format, ...) -> void {
+  if (level > getLogLevel()) {
+    return;
+  }
+
+  std::fprintf(stderr, "%s: ", tag);
+
+  va_list arguments;
+  va_start(arguments, format);
+  std::vfprintf(stderr, format, arguments);
+  va_end(arguments);
+
+  std::fputc('\n', stderr);
+}
+
+auto esp_cpu_get_cycle_count() -> esp_cpu_cycle_count_t {
+  auto const elapsedNS = std::chrono::duration_cast<std::chrono::nanoseconds>(getElapsed()).count();
+  return static_cast<esp_cpu_cycle_count_t>(elapsedNS * CPU_TICKS_PER_US / 1000);
+}
+
+auto esp_cpu_get_core_id() -> int {
+  return 0;
+}
+
+auto esp_rom_get_cpu_ticks_per_us() -> std::uint32_t {
+  return CPU_TICKS_PER_US;
+}
+
+auto heap_caps_malloc(std::size_t const size, std::uint32_t) -> void* {
+  return std::malloc(size);
+}
+
+auto heap_caps_calloc(std::size_t const count, std::size_t const size, std::uint32_t) -> void* {
+  return std::calloc(count, size);
+}
+
+auto heap_caps_free(void* const pointer) -> void {
+  std::free(pointer);
+}
+
+auto esp_timer_get_time() -> std::int64_t {
+  return std::chrono::duration_cast<std::chrono::microseconds>(getElapsed()).count();
+}
+
+auto esp_timer_create(esp_timer_create_args_t const* const args, esp_timer_handle_t* const timer) -> esp_err_t {
+  *timer = new esp_timer{.args = *args};
+  return ESP_OK;
+}
+
+auto esp_timer_start_once(esp_timer_handle_t, std::uint64_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto esp_timer_stop(esp_timer_handle_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto esp_timer_delete(esp_timer_handle_t const timer) -> esp_err_t {
+  delete timer;
+  return ESP_OK;
+}
+
+auto esp_timer_isr_dispatch_need_yield() -> void {
+}
+
+auto esp_pm_lock_create(esp_pm_lock_type_t, int, char const*, esp_pm_lock_handle_t*) -> esp_err_t {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+auto esp_pm_lock_delete(esp_pm_lock_handle_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto esp_pm_lock_acquire(esp_pm_lock_handle_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto esp_pm_lock_release(esp_pm_lock_handle_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto esp_sleep_enable_gpio_wakeup() -> esp_err_t {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+gpio_dev_t GPIO = {};
+
+auto gpio_config(gpio_config_t const*) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto gpio_get_level(gpio_num_t) -> int {
+  return 0;
+}
+
+auto gpio_set_level(gpio_num_t, std::uint32_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto gpio_install_isr_service(int) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto gpio_isr_handler_add(gpio_num_t, gpio_isr_t, void*) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto gpio_isr_handler_remove(gpio_num_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto gpio_set_intr_type(gpio_num_t, gpio_int_type_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto gpio_intr_enable(gpio_num_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto gpio_intr_disable(gpio_num_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto gpio_wakeup_enable(gpio_num_t, gpio_int_type_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto gpio_wakeup_disable(gpio_num_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto rmt_enable(rmt_channel_handle_t) -> esp_err_t {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+auto rmt_disable(rmt_channel_handle_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto rmt_del_channel(rmt_channel_handle_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto rmt_new_rx_channel(rmt_rx_channel_config_t const*, rmt_channel_handle_t*) -> esp_err_t {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+auto rmt_receive(rmt_channel_handle_t, void*, std::size_t, rmt_receive_config_t const*) -> esp_err_t {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+auto rmt_rx_register_event_callbacks(rmt_channel_handle_t, rmt_rx_event_callbacks_t const*, void*) -> esp_err_t {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+auto rmt_new_tx_channel(rmt_tx_channel_config_t const*, rmt_channel_handle_t*) -> esp_err_t {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+auto rmt_new_simple_encoder(rmt_simple_encoder_config_t const*, rmt_encoder_handle_t*) -> esp_err_t {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+auto rmt_del_encoder(rmt_encoder_handle_t) -> esp_err_t {
+  return ESP_OK;
+}
+
+auto rmt_transmit(rmt_channel_handle_t, rmt_encoder_handle_t, void const*, std::size_t, rmt_transmit_config_t const*) -> esp_err_t {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+auto rmt_tx_register_event_callbacks(rmt_channel_handle_t, rmt_tx_event_callbacks_t const*, void*) -> esp_err_t {
+  return ESP_ERR_NOT_SUPPORTED;
+}
@@ -0,0 +1,76 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "esp_err.h"
+
+enum gpio_num_t {
+  GPIO_NUM_NC = -1,
+  GPIO_NUM_0  = 0,
+};
+
+enum gpio_mode_t {
+  GPIO_MODE_DISABLE,
+  GPIO_MODE_INPUT,
+  GPIO_MODE_OUTPUT,
+  GPIO_MODE_INPUT_OUTPUT,
+};
+
+enum gpio_pullup_t {
+  GPIO_PULLUP_DISABLE,
+  GPIO_PULLUP_ENABLE,
+};
+
+enum gpio_pulldown_t {
+  GPIO_PULLDOWN_DISABLE,
+  GPIO_PULLDOWN_ENABLE,
+};
+
+enum gpio_int_type_t {
+  GPIO_INTR_DISABLE,
+  GPIO_INTR_POSEDGE,
+  GPIO_INTR_NEGEDGE,
+  GPIO_INTR_ANYEDGE,
+  GPIO_INTR_LOW_LEVEL,
+  GPIO_INTR_HIGH_LEVEL,
+};
+
+struct gpio_config_t {
+  std::uint64_t pin_bit_mask;
+  gpio_mode_t mode;
+  gpio_pullup_t pull_up_en;
+  gpio_pulldown_t pull_down_en;
+  gpio_int_type_t intr_type;
+};
+
+using gpio_isr_t = void (*)(void* arg);
+
+auto gpio_config(gpio_config_t const* config) -> esp_err_t;
+auto gpio_get_level(gpio_num_t pin) -> int;
+auto gpio_set_level(gpio_num_t pin, std::uint32_t level) -> esp_err_t;
+auto gpio_install_isr_service(int flags) -> esp_err_t;
+auto gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t handler, void* arg) -> esp_err_t;
+auto gpio_isr_handler_remove(gpio_num_t pin) -> esp_err_t;
+auto gpio_set_intr_type(gpio_num_t pin, gpio_int_type_t type) -> esp_err_t;
+auto gpio_intr_enable(gpio_num_t pin) -> esp_err_t;
+auto gpio_intr_disable(gpio_num_t pin) -> esp_err_t;
+auto gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type) -> esp_err_t;
+auto gpio_wakeup_disable(gpio_num_t pin) -> esp_err_t;
@@ -0,0 +1,51 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include "driver/rmt_types.h"
+
+struct rmt_rx_channel_config_t {
+  gpio_num_t gpio_num;
+  rmt_clock_source_t clk_src;
+  std::uint32_t resolution_hz;
+  std::size_t mem_block_symbols;
+  int intr_priority;
+  struct {
+    std::uint32_t invert_in : 1;
+    std::uint32_t with_dma : 1;
+    std::uint32_t io_loop_back : 1;
+    std::uint32_t allow_pd : 1;
+  } flags;
+};
+
+struct rmt_receive_config_t {
+  std::uint32_t signal_range_min_ns;
+  std::uint32_t signal_range_max_ns;
+  struct {
+    std::uint32_t en_partial_rx : 1;
+  } flags;
+};
+
+struct rmt_rx_event_callbacks_t {
+  rmt_rx_done_callback_t on_recv_done;
+};
+
+auto rmt_new_rx_channel(rmt_rx_channel_config_t const* config, rmt_channel_handle_t* channel) -> esp_err_t;
+auto rmt_receive(rmt_channel_handle_t channel, void* buffer, std::size_t size, rmt_receive_config_t const* config) -> esp_err_t;
+auto rmt_rx_register_event_callbacks(rmt_channel_handle_t channel, rmt_rx_event_callbacks_t const* callbacks, void* context) -> esp_err_t;
@@ -0,0 +1,64 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include "driver/rmt_types.h"
+
+struct rmt_tx_channel_config_t {
+  gpio_num_t gpio_num;
+  rmt_clock_source_t clk_src;
+  std::uint32_t resolution_hz;
+  std::size_t mem_block_symbols;
+  std::size_t trans_queue_depth;
+  int intr_priority;
+  struct {
+    std::uint32_t invert_out : 1;
+    std::uint32_t with_dma : 1;
+    std::uint32_t io_loop_back : 1;
+    std::uint32_t io_od_mode : 1;
+    std::uint32_t allow_pd : 1;
+  } flags;
+};
+
+struct rmt_transmit_config_t {
+  int loop_count;
+  struct {
+    std::uint32_t eot_level : 1;
+    std::uint32_t queue_nonblocking : 1;
+  } flags;
+};
+
+struct rmt_tx_event_callbacks_t {
+  rmt_tx_done_callback_t on_trans_done;
+};
+
+using rmt_encode_simple_cb_t = std::size_t (*)(void const* data, std::size_t size, std::size_t written, std::size_t free, rmt_symbol_word_t* symbols, bool* isDone,
+                                               void* context);
+
+struct rmt_simple_encoder_config_t {
+  rmt_encode_simple_cb_t callback;
+  void* arg;
+  std::size_t min_chunk_size;
+};
+
+auto rmt_new_tx_channel(rmt_tx_channel_config_t const* config, rmt_channel_handle_t* channel) -> esp_err_t;
+auto rmt_new_simple_encoder(rmt_simple_encoder_config_t const* config, rmt_encoder_handle_t* encoder) -> esp_err_t;
+auto rmt_del_encoder(rmt_encoder_handle_t encoder) -> esp_err_t;
+auto rmt_transmit(rmt_channel_handle_t channel, rmt_encoder_handle_t encoder, void const* data, std::size_t size, rmt_transmit_config_t const* config) -> esp_err_t;
+auto rmt_tx_register_event_callbacks(rmt_channel_handle_t channel, rmt_tx_event_callbacks_t const* callbacks, void* context) -> esp_err_t;
@@ -0,0 +1,63 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "driver/gpio.h"
+
+union rmt_symbol_word_t {
+  struct {
+    std::uint16_t duration0 : 15;
+    std::uint16_t level0 : 1;
+    std::uint16_t duration1 : 15;
+    std::uint16_t level1 : 1;
+  };
+  std::uint32_t val;
+};
+
+struct rmt_channel_t;
+using rmt_channel_handle_t = rmt_channel_t*;
+
+struct rmt_encoder_t;
+using rmt_encoder_handle_t = rmt_encoder_t*;
+
+enum rmt_clock_source_t {
+  RMT_CLK_SRC_DEFAULT = 4,
+};
+
+struct rmt_rx_done_event_data_t {
+  rmt_symbol_word_t* received_symbols;
+  std::size_t num_symbols;
+  struct {
+    std::uint32_t is_last : 1;
+  } flags;
+};
+
+struct rmt_tx_done_event_data_t {
+  std::size_t num_symbols;
+};
+
+using rmt_rx_done_callback_t = bool (*)(rmt_channel_handle_t channel, rmt_rx_done_event_data_t const* data, void* context);
+using rmt_tx_done_callback_t = bool (*)(rmt_channel_handle_t channel, rmt_tx_done_event_data_t const* data, void* context);
+
+auto rmt_enable(rmt_channel_handle_t channel) -> esp_err_t;
+auto rmt_disable(rmt_channel_handle_t channel) -> esp_err_t;
+auto rmt_del_channel(rmt_channel_handle_t channel) -> esp_err_t;
@@ -0,0 +1,35 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include "esp_err.h"
+
+enum esp_pm_lock_type_t {
+  ESP_PM_CPU_FREQ_MAX,
+  ESP_PM_APB_FREQ_MAX,
+  ESP_PM_NO_LIGHT_SLEEP,
+};
+
+struct esp_pm_lock;
+using esp_pm_lock_handle_t = esp_pm_lock*;
+
+auto esp_pm_lock_create(esp_pm_lock_type_t type, int argument, char const* name, esp_pm_lock_handle_t* lock) -> esp_err_t;
+auto esp_pm_lock_delete(esp_pm_lock_handle_t lock) -> esp_err_t;
+auto esp_pm_lock_acquire(esp_pm_lock_handle_t lock) -> esp_err_t;
+auto esp_pm_lock_release(esp_pm_lock_handle_t lock) -> esp_err_t;
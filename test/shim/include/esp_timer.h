@@ -0,0 +1,47 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "esp_err.h"
+
+struct esp_timer;
+using esp_timer_handle_t = esp_timer*;
+using esp_timer_cb_t     = void (*)(void* arg);
+
+enum esp_timer_dispatch_t {
+  ESP_TIMER_TASK,
+  ESP_TIMER_ISR,
+};
+
+struct esp_timer_create_args_t {
+  esp_timer_cb_t callback;
+  void* arg;
+  esp_timer_dispatch_t dispatch_method;
+  char const* name;
+  bool skip_unhandled_events;
+};
+
+auto esp_timer_get_time() -> std::int64_t;
+auto esp_timer_create(esp_timer_create_args_t const* args, esp_timer_handle_t* timer) -> esp_err_t;
+auto esp_timer_start_once(esp_timer_handle_t timer, std::uint64_t timeoutUS) -> esp_err_t;
+auto esp_timer_stop(esp_timer_handle_t timer) -> esp_err_t;
+auto esp_timer_delete(esp_timer_handle_t timer) -> esp_err_t;
+auto esp_timer_isr_dispatch_need_yield() -> void;
@@ -0,0 +1,61 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+// Host shim of the ESP-IDF and FreeRTOS API used by the component.
+// There is no scheduler: task creation fails, time follows the host steady clock,
+// interrupts and timers never fire, so only the backend paths run on the host
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+using TickType_t  = std::uint32_t;
+using BaseType_t  = int;
+using UBaseType_t = unsigned;
+
+#define configTICK_RATE_HZ 1000
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define errQUEUE_FULL pdFALSE
+
+#define portMAX_DELAY static_cast<TickType_t>(0xFFFFFFFFUL)
+#define pdMS_TO_TICKS(ms) static_cast<TickType_t>((static_cast<std::uint64_t>(ms) * configTICK_RATE_HZ) / 1000)
+#define pdTICKS_TO_MS(ticks) static_cast<TickType_t>((static_cast<std::uint64_t>(ticks) * 1000) / configTICK_RATE_HZ)
+#define portTICK_PERIOD_MS (static_cast<TickType_t>(1000) / configTICK_RATE_HZ)
+
+#define tskIDLE_PRIORITY 0
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+struct portMUX_TYPE {
+  std::uint32_t owner;
+  std::uint32_t count;
+};
+
+#define portMUX_INITIALIZER_UNLOCKED {0, 0}
+
+#define portENTER_CRITICAL(mux) static_cast<void>(mux)
+#define portEXIT_CRITICAL(mux) static_cast<void>(mux)
+#define portENTER_CRITICAL_ISR(mux) static_cast<void>(mux)
+#define portEXIT_CRITICAL_ISR(mux) static_cast<void>(mux)
+#define portYIELD_FROM_ISR(...)
+
+#define configASSERT(condition)
@@ -0,0 +1,31 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+struct QueueDefinition;
+using QueueHandle_t = QueueDefinition*;
+
+auto xQueueCreate(UBaseType_t length, UBaseType_t itemSize) -> QueueHandle_t;
+auto vQueueDelete(QueueHandle_t queue) -> void;
+auto xQueueSend(QueueHandle_t queue, void const* item, TickType_t timeout) -> BaseType_t;
+auto xQueueSendFromISR(QueueHandle_t queue, void const* item, BaseType_t* isTaskWoken) -> BaseType_t;
+auto xQueueReceive(QueueHandle_t queue, void* item, TickType_t timeout) -> BaseType_t;
+auto uxQueueMessagesWaiting(QueueHandle_t queue) -> UBaseType_t;
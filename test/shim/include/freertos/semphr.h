@@ -0,0 +1,35 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include "freertos/queue.h"
+
+using SemaphoreHandle_t = QueueHandle_t;
+
+struct StaticSemaphore_t {
+  alignas(std::max_align_t) unsigned char storage[96];
+};
+
+auto xSemaphoreCreateBinary() -> SemaphoreHandle_t;
+auto xSemaphoreCreateBinaryStatic(StaticSemaphore_t* buffer) -> SemaphoreHandle_t;
+auto xSemaphoreCreateMutexStatic(StaticSemaphore_t* buffer) -> SemaphoreHandle_t;
+auto xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t timeout) -> BaseType_t;
+auto xSemaphoreGive(SemaphoreHandle_t semaphore) -> BaseType_t;
+auto xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t* isTaskWoken) -> BaseType_t;
+auto vSemaphoreDelete(SemaphoreHandle_t semaphore) -> void;
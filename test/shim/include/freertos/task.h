@@ -0,0 +1,48 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+struct tskTaskControlBlock;
+using TaskHandle_t   = tskTaskControlBlock*;
+using TaskFunction_t = void (*)(void*);
+
+enum eNotifyAction {
+  eNoAction,
+  eSetBits,
+  eIncrement,
+  eSetValueWithOverwrite,
+  eSetValueWithoutOverwrite,
+};
+
+auto xTaskCreate(TaskFunction_t function, char const* name, std::uint32_t stackDepth, void* parameters, UBaseType_t priority, TaskHandle_t* task) -> BaseType_t;
+auto xTaskCreatePinnedToCore(TaskFunction_t function, char const* name, std::uint32_t stackDepth, void* parameters, UBaseType_t priority, TaskHandle_t* task,
+                             BaseType_t core) -> BaseType_t;
+auto vTaskDelete(TaskHandle_t task) -> void;
+auto vTaskDelay(TickType_t ticks) -> void;
+
+auto xTaskGetCurrentTaskHandle() -> TaskHandle_t;
+auto xTaskGetTickCount() -> TickType_t;
+
+auto ulTaskNotifyTake(BaseType_t isClearOnExit, TickType_t timeout) -> std::uint32_t;
+auto xTaskNotifyGive(TaskHandle_t task) -> BaseType_t;
+auto xTaskNotify(TaskHandle_t task, std::uint32_t value, eNotifyAction action) -> BaseType_t;
+auto xTaskNotifyWait(std::uint32_t clearOnEntry, std::uint32_t clearOnExit, std::uint32_t* value, TickType_t timeout) -> BaseType_t;
+auto vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* isTaskWoken) -> void;
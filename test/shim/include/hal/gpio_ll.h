@@ -0,0 +1,32 @@
+// Copyright 2025 Pavel Suprunov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Created by jadjer on 14.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "driver/gpio.h"
+#include "soc/gpio_struct.h"
+
+inline auto gpio_ll_get_level(gpio_dev_t*, std::uint32_t const pin) -> int {
+  return gpio_get_level(static_cast<gpio_num_t>(pin));
+}
+
+inline auto gpio_ll_set_level(gpio_dev_t*, std::uint32_t const pin, std::uint32_t const level) -> void {
+  gpio_set_level(static_cast<gpio_num_t>(pin), level);
+}